@@ -25,6 +25,8 @@
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
 
     SAUDIO_RING_MAX_SLOTS   - max number of slots in the push-audio ring buffer (default 1024)
+    SAUDIO_NO_SIMD          - don't use SSE2/NEON for sample format conversion
+    SAUDIO_MAX_STREAMS      - max number of simultaneously active audio streams (default 4)
 
     If sokol_audio.h is compiled as a DLL, define the following before
     including the declaration or implementation:
@@ -36,8 +38,9 @@
 
     FEATURE OVERVIEW
     ================
-    You provide a mono- or stereo-stream of 32-bit float samples, which
-    Sokol Audio feeds into platform-specific audio backends:
+    You provide a mono- or stereo-stream of 32-bit float or 16-bit signed
+    integer samples, which Sokol Audio feeds into platform-specific audio
+    backends:
 
     - Windows: WASAPI
     - Linux: ALSA (link with asound)
@@ -48,7 +51,9 @@
 
     Sokol Audio will not do any buffer mixing or volume control, if you have
     multiple independent input streams of sample data you need to perform the
-    mixing yourself before forwarding the data to Sokol Audio.
+    mixing yourself before forwarding the data to Sokol Audio, or create
+    several audio streams (see MULTIPLE STREAMS), each with its own
+    backend device and playback parameters.
 
     There are two mutually exclusive ways to provide the sample data:
 
@@ -103,7 +108,7 @@
     - sample:
         The magnitude of an audio signal on one channel at a given time. In
         Sokol Audio, samples are 32-bit float numbers in the range -1.0 to
-        +1.0.
+        +1.0, or optionally 16-bit signed integers (see SAMPLE FORMATS).
 
     - frame:
         The tightly packed set of samples for all channels at a given time.
@@ -152,6 +157,7 @@
         int sample_rate     -- the sample rate in Hz, default: 44100
         int num_channels    -- number of channels, default: 1 (mono)
         int buffer_frames   -- number of frames in streaming buffer, default: 2048
+        saudio_format format -- the internal sample format, default: SAUDIO_FORMAT_FLOAT
 
     The stream callback prototype (either with or without userdata):
 
@@ -284,6 +290,143 @@
             }
         }
 
+    SAMPLE FORMATS
+    ==============
+    By default, Sokol Audio uses 32-bit float samples everywhere: in the
+    push-model ring buffer, in the stream callback and (where the backend
+    supports it) in the audio device buffer.
+
+    Optionally, 16-bit signed integer samples can be selected as the
+    internal sample format:
+
+        saudio_setup(&(saudio_desc){
+            .format = SAUDIO_FORMAT_S16
+        });
+
+    With SAUDIO_FORMAT_S16, the push-model ring buffer and the backend
+    streaming buffers store 16-bit samples, which halves the memory traffic
+    between your code and the audio thread, and backends which accept
+    16-bit samples directly (ALSA, CoreAudio, WASAPI and OpenSLES) don't
+    need to convert samples at all.
+
+    Sample data can be pushed either as float or as int16_t samples, if
+    the pushed data doesn't match the internal sample format, it will be
+    converted while it is copied into the ring buffer:
+
+        int saudio_push(const float* frames, int num_frames)
+        int saudio_push_s16(const int16_t* frames, int num_frames)
+
+    The stream callback always works with float samples. When the internal
+    sample format is SAUDIO_FORMAT_S16, the callback writes into an
+    intermediate buffer which is converted once on the audio thread. Note
+    that in this case the callback may be called several times with
+    smaller num_frames values for a single backend buffer.
+
+    Float-to-int conversion clamps samples to the -1.0 to +1.0 range and
+    uses SSE2 or NEON when available (define SAUDIO_NO_SIMD to disable this).
+
+    MULTIPLE STREAMS
+    ================
+    saudio_setup() creates a 'default stream' which is used by all the
+    functions described above. If you need additional output streams with
+    different playback parameters (for instance a low-latency stream with
+    a small buffer for sound effects, and a high-latency stream with a big
+    buffer for music), create them with:
+
+        saudio_stream music = saudio_make_stream(&(saudio_desc){
+            .buffer_frames = 8192,
+            .packet_frames = 512,
+            .num_packets = 64,
+            .num_channels = 2,
+        });
+
+    saudio_make_stream() must be called after saudio_setup(). Each stream
+    has its own ring buffer, backend device, and (depending on the backend)
+    its own streaming thread. The saudio_desc struct works the same as
+    in saudio_setup(), for the callback model provide a stream callback,
+    otherwise push sample data with:
+
+        int saudio_stream_expect(saudio_stream stream)
+        int saudio_stream_push(saudio_stream stream, const float* frames, int num_frames)
+        int saudio_stream_push_s16(saudio_stream stream, const int16_t* frames, int num_frames)
+
+    The actual playback parameters of a stream can be queried with:
+
+        bool saudio_stream_isvalid(saudio_stream stream)
+        int saudio_stream_sample_rate(saudio_stream stream)
+        int saudio_stream_buffer_frames(saudio_stream stream)
+        int saudio_stream_channels(saudio_stream stream)
+        saudio_format saudio_stream_sample_format(saudio_stream stream)
+        saudio_desc saudio_stream_query_desc(saudio_stream stream)
+        void* saudio_stream_userdata(saudio_stream stream)
+
+    The functions without a stream argument (e.g. saudio_push()) are
+    wrappers which operate on the default stream, the handle of the
+    default stream can be obtained with:
+
+        saudio_stream saudio_default_stream(void)
+
+    Streams are destroyed with saudio_destroy_stream(), saudio_shutdown()
+    will destroy all streams which are still alive. Note that the
+    saudio_make_stream() and saudio_destroy_stream() functions are not
+    thread-safe and must be called from the same thread as saudio_setup().
+
+    The maximum number of streams is 4, this can be changed by defining
+    SAUDIO_MAX_STREAMS before including the implementation.
+
+    Sokol Audio still doesn't do any mixing, all streams are mixed by the
+    operating system's audio system.
+
+    OFFLINE RENDERING
+    =================
+    For automated tests, or to 'bake' audio data into files, a stream can
+    run without an audio device. Set saudio_desc.offline to true, and
+    optionally provide a sink callback which receives the rendered frames:
+
+        saudio_setup(&(saudio_desc){
+            .offline = true,
+            .stream_cb = my_stream_callback,
+            .offline_sink_cb = my_sink_callback,
+        });
+
+    No backend device and no streaming thread is created for an offline
+    stream, instead the rendering is driven from your own code by calling:
+
+        int saudio_render(int num_frames)
+        int saudio_stream_render(saudio_stream stream, int num_frames)
+
+    This renders num_frames (rounded down to a multiple of the packet size)
+    as fast as possible on the calling thread, and returns the number of
+    frames that have actually been rendered. The stream callback is called
+    with chunks of saudio_buffer_frames() frames, in the push model the
+    rendering pulls packets from the ring buffer (and renders silence if
+    not enough data has been pushed), this makes the output deterministic.
+
+    The sink callback is called with the rendered sample data in the
+    internal sample format (float or int16_t, see SAMPLE FORMATS), e.g.
+    to write SAUDIO_FORMAT_S16 samples to a WAV file:
+
+        void my_sink_callback(const void* buffer, int num_frames, int num_channels) {
+            fwrite(buffer, sizeof(int16_t) * num_channels, num_frames, wav_file);
+        }
+
+    Like the stream callback, there's an alternative sink callback
+    saudio_desc.offline_sink_userdata_cb with the saudio_desc.user_data
+    argument.
+
+    To benchmark mixing and DSP code, query the 'realtime factor', the
+    ratio of rendered audio time to the wall-clock time spent in
+    saudio_render() (measured with a monotonic clock):
+
+        double saudio_realtime_factor(void)
+        double saudio_stream_realtime_factor(saudio_stream stream)
+
+    For instance a realtime factor of 50.0 means that one second of audio
+    data was rendered in 20 milliseconds.
+
+    Offline streams work on all platforms and can be combined with
+    regular streams (see MULTIPLE STREAMS).
+
     THE WEBAUDIO BACKEND
     ====================
     The WebAudio backend is currently using a ScriptProcessorNode callback to
@@ -318,8 +461,8 @@
     For thread synchronisation, the CoreAudio backend will use the
     pthread_mutex_* functions.
 
-    The incoming floating point samples will be directly forwarded to
-    CoreAudio without further conversion.
+    The incoming floating point (or 16-bit integer) samples will be
+    directly forwarded to CoreAudio without further conversion.
 
     macOS and iOS applications that use Sokol Audio need to link with
     the AudioToolbox framework.
@@ -334,7 +477,7 @@
     WASAPI may use a different size for its own streaming buffer then requested,
     so the base latency may be slightly bigger. The current backend implementation
     converts the incoming floating point sample values to signed 16-bit
-    integers.
+    integers (no conversion is necessary with SAUDIO_FORMAT_S16).
 
     The required Windows system DLLs are linked with #pragma comment(lib, ...),
     so you shouldn't need to add additional linker libs in the build process
@@ -347,8 +490,9 @@
 
     For thread synchronisation, the pthread_mutex_* functions are used.
 
-    Samples are directly forwarded to ALSA in 32-bit float format, no
-    further conversion is taking place.
+    Samples are directly forwarded to ALSA in 32-bit float or 16-bit
+    integer format (depending on saudio_desc.format), no further
+    conversion is taking place.
 
     You need to link with the 'asound' library, and the <alsa/asoundlib.h>
     header must be present (usually both are installed with some sort
@@ -401,15 +545,31 @@
 extern "C" {
 #endif
 
+/* an audio stream handle (created with saudio_make_stream()) */
+typedef struct saudio_stream { uint32_t id; } saudio_stream;
+
+/* the internal sample format (ring buffer and backend buffers) */
+typedef enum saudio_format {
+    _SAUDIO_FORMAT_DEFAULT, /* value 0 reserved for default-init */
+    SAUDIO_FORMAT_FLOAT,    /* 32-bit float samples in range -1.0 .. +1.0 */
+    SAUDIO_FORMAT_S16,      /* 16-bit signed integer samples */
+    _SAUDIO_FORMAT_NUM,
+    _SAUDIO_FORMAT_FORCE_U32 = 0x7FFFFFFF
+} saudio_format;
+
 typedef struct saudio_desc {
     int sample_rate;        /* requested sample rate */
     int num_channels;       /* number of channels, default: 1 (mono) */
     int buffer_frames;      /* number of frames in streaming buffer */
     int packet_frames;      /* number of frames in a packet */
     int num_packets;        /* number of packets in packet queue */
+    saudio_format format;   /* internal sample format, default: SAUDIO_FORMAT_FLOAT */
     void (*stream_cb)(float* buffer, int num_frames, int num_channels);  /* optional streaming callback (no user data) */
     void (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data); /*... and with user data */
-    void* user_data;        /* optional user data argument for stream_userdata_cb */
+    void* user_data;        /* optional user data argument for stream_userdata_cb and offline_sink_userdata_cb */
+    bool offline;           /* render without an audio device (see OFFLINE RENDERING) */
+    void (*offline_sink_cb)(const void* buffer, int num_frames, int num_channels);    /* optional sink for rendered offline frames (no user data) */
+    void (*offline_sink_userdata_cb)(const void* buffer, int num_frames, int num_channels, void* user_data); /*... and with user data */
 } saudio_desc;
 
 /* setup sokol-audio */
@@ -432,12 +592,42 @@ SOKOL_AUDIO_API_DECL int saudio_channels(void);
 SOKOL_AUDIO_API_DECL int saudio_expect(void);
 /* push sample frames from main thread, returns number of frames actually pushed */
 SOKOL_AUDIO_API_DECL int saudio_push(const float* frames, int num_frames);
+/* same as saudio_push(), but with 16-bit signed integer samples */
+SOKOL_AUDIO_API_DECL int saudio_push_s16(const int16_t* frames, int num_frames);
+/* the actual internal sample format */
+SOKOL_AUDIO_API_DECL saudio_format saudio_sample_format(void);
+
+/* get the default stream created in saudio_setup() */
+SOKOL_AUDIO_API_DECL saudio_stream saudio_default_stream(void);
+/* create an additional audio stream with its own ring buffer and backend device */
+SOKOL_AUDIO_API_DECL saudio_stream saudio_make_stream(const saudio_desc* desc);
+/* destroy an audio stream */
+SOKOL_AUDIO_API_DECL void saudio_destroy_stream(saudio_stream stream);
+/* per-stream equivalents of the functions above */
+SOKOL_AUDIO_API_DECL bool saudio_stream_isvalid(saudio_stream stream);
+SOKOL_AUDIO_API_DECL void* saudio_stream_userdata(saudio_stream stream);
+SOKOL_AUDIO_API_DECL saudio_desc saudio_stream_query_desc(saudio_stream stream);
+SOKOL_AUDIO_API_DECL int saudio_stream_sample_rate(saudio_stream stream);
+SOKOL_AUDIO_API_DECL int saudio_stream_buffer_frames(saudio_stream stream);
+SOKOL_AUDIO_API_DECL int saudio_stream_channels(saudio_stream stream);
+SOKOL_AUDIO_API_DECL saudio_format saudio_stream_sample_format(saudio_stream stream);
+SOKOL_AUDIO_API_DECL int saudio_stream_expect(saudio_stream stream);
+SOKOL_AUDIO_API_DECL int saudio_stream_push(saudio_stream stream, const float* frames, int num_frames);
+SOKOL_AUDIO_API_DECL int saudio_stream_push_s16(saudio_stream stream, const int16_t* frames, int num_frames);
+
+/* render frames of an offline stream into the offline sink, returns number of rendered frames */
+SOKOL_AUDIO_API_DECL int saudio_render(int num_frames);
+SOKOL_AUDIO_API_DECL int saudio_stream_render(saudio_stream stream, int num_frames);
+/* ratio of rendered audio time to wall-clock time spent in saudio_render() */
+SOKOL_AUDIO_API_DECL double saudio_realtime_factor(void);
+SOKOL_AUDIO_API_DECL double saudio_stream_realtime_factor(saudio_stream stream);
 
 #ifdef __cplusplus
 } /* extern "C" */
 
 /* reference-based equivalents for c++ */
 inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc); }
+inline saudio_stream saudio_make_stream(const saudio_desc& desc) { return saudio_make_stream(&desc); }
 
 #endif
 #endif // SOKOL_AUDIO_INCLUDED
@@ -446,6 +636,7 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
 #ifdef SOKOL_AUDIO_IMPL
 #define SOKOL_AUDIO_IMPL_INCLUDED (1)
 #include <string.h> // memset, memcpy
+#include <time.h>   // clock_gettime, clock
 #include <stddef.h> // size_t
 
 #ifndef SOKOL_API_IMPL
@@ -486,6 +677,16 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
     #define _SOKOL_UNUSED(x) (void)(x)
 #endif
 
+#if !defined(SAUDIO_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define _SAUDIO_SSE2 (1)
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define _SAUDIO_NEON (1)
+        #include <arm_neon.h>
+    #endif
+#endif
+
 #if defined(SOKOL_DUMMY_BACKEND)
     // No threads needed for SOKOL_DUMMY_BACKEND
 #elif (defined(__APPLE__) || defined(__linux__) || defined(__unix__)) && !defined(__EMSCRIPTEN__)
@@ -563,6 +764,21 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
     #include <emscripten/emscripten.h>
 #endif
 
+/* monotonic wall clock for measuring offline rendering */
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__APPLE__)
+    #include <mach/mach_time.h>
+#elif defined(__EMSCRIPTEN__)
+    #include <emscripten/emscripten.h>
+#endif
+
 #ifdef _MSC_VER
     #pragma warning(push)
     #pragma warning(disable:4505)   /* unreferenced local function has been removed */
@@ -575,11 +791,18 @@ inline void saudio_setup(const saudio_desc& desc) { return saudio_setup(&desc);
 #define _SAUDIO_DEFAULT_BUFFER_FRAMES (2048)
 #define _SAUDIO_DEFAULT_PACKET_FRAMES (128)
 #define _SAUDIO_DEFAULT_NUM_PACKETS ((_SAUDIO_DEFAULT_BUFFER_FRAMES/_SAUDIO_DEFAULT_PACKET_FRAMES)*4)
+#define _SAUDIO_CONVERT_CHUNK_SAMPLES (1024)
 
 #ifndef SAUDIO_RING_MAX_SLOTS
 #define SAUDIO_RING_MAX_SLOTS (1024)
 #endif
 
+#ifndef SAUDIO_MAX_STREAMS
+#define SAUDIO_MAX_STREAMS (4)
+#endif
+#define _SAUDIO_SLOT_SHIFT (16)
+#define _SAUDIO_SLOT_MASK ((1<<_SAUDIO_SLOT_SHIFT)-1)
+
 /*=== MUTEX WRAPPER DECLARATIONS =============================================*/
 #if defined(SOKOL_DUMMY_BACKEND)
 
@@ -606,28 +829,42 @@ typedef struct { int dummy_mutex; } _saudio_mutex_t;
 typedef struct {
     int dummy_backend;
 } _saudio_backend_t;
+
+typedef struct {
+    int dummy_backend;
+} _saudio_backend_shared_t;
 /*=== COREAUDIO BACKEND DECLARATIONS =========================================*/
 #elif defined(__APPLE__)
 
 typedef struct {
     AudioQueueRef ca_audio_queue;
+} _saudio_backend_t;
+
+/* the iOS audio session is shared by all streams */
+typedef struct {
     #if TARGET_OS_IOS
     id ca_interruption_handler;
+    #else
+    int dummy;
     #endif
-} _saudio_backend_t;
+} _saudio_backend_shared_t;
 
 /*=== ALSA BACKEND DECLARATIONS ==============================================*/
 #elif (defined(__linux__) || defined(__unix__)) && !defined(__EMSCRIPTEN__) && !defined(__ANDROID__)
 
 typedef struct {
     snd_pcm_t* device;
-    float* buffer;
+    void* buffer;
     int buffer_byte_size;
     int buffer_frames;
     pthread_t thread;
     bool thread_stop;
 } _saudio_backend_t;
 
+typedef struct {
+    int dummy;
+} _saudio_backend_shared_t;
+
 /*=== OpenSLES BACKEND DECLARATIONS ==============================================*/
 #elif defined(__ANDROID__)
 
@@ -639,11 +876,15 @@ typedef struct {
     int count;
 } _saudio_semaphore_t;
 
+/* OpenSLES only allows one engine object, this is shared by all streams */
 typedef struct {
     SLObjectItf engine_obj;
     SLEngineItf engine;
     SLObjectItf output_mix_obj;
     SLVolumeItf output_mix_vol;
+} _saudio_backend_shared_t;
+
+typedef struct {
     SLDataLocator_OutputMix out_locator;
     SLDataSink dst_data_sink;
     SLObjectItf player_obj;
@@ -652,7 +893,7 @@ typedef struct {
     SLAndroidSimpleBufferQueueItf player_buffer_queue;
 
     int16_t* output_buffers[SAUDIO_NUM_BUFFERS];
-    float* src_buffer;
+    float* src_buffer;          /* only used with SAUDIO_FORMAT_FLOAT */
     int active_buffer;
     _saudio_semaphore_t buffer_sem;
     pthread_t thread;
@@ -670,8 +911,8 @@ typedef struct {
     UINT32 dst_buffer_frames;
     int src_buffer_frames;
     int src_buffer_byte_size;
-    int src_buffer_pos;
-    float* src_buffer;
+    int src_buffer_pos;         /* in number of samples */
+    void* src_buffer;           /* in the internal sample format */
 } _saudio_wasapi_thread_data_t;
 
 typedef struct {
@@ -690,6 +931,14 @@ typedef struct {
     _saudio_wasapi_thread_data_t thread;
 } _saudio_backend_t;
 
+typedef struct {
+    #if defined(SOKOL_WIN32_NO_MMDEVICE)
+    _saudio_backend_t* activating_backend;    /* the backend waiting for interface activation */
+    #else
+    int dummy;
+    #endif
+} _saudio_backend_shared_t;
+
 /*=== WEBAUDIO BACKEND DECLARATIONS ==========================================*/
 #elif defined(__EMSCRIPTEN__)
 
@@ -697,9 +946,14 @@ typedef struct {
     uint8_t* buffer;
 } _saudio_backend_t;
 
+typedef struct {
+    int dummy;
+} _saudio_backend_shared_t;
+
 /*=== DUMMY BACKEND DECLARATIONS =============================================*/
 #else
 typedef struct { } _saudio_backend_t;
+typedef struct { } _saudio_backend_shared_t;
 #endif
 /*=== GENERAL DECLARATIONS ===================================================*/
 
@@ -724,9 +978,10 @@ typedef struct {
     _saudio_ring_t write_queue; /* empty buffers, ready to be pushed to */
 } _saudio_fifo_t;
 
-/* sokol-audio state */
+/* per-stream state */
 typedef struct {
     bool valid;
+    uint32_t id;                /* public handle id, 0 if slot is free */
     void (*stream_cb)(float* buffer, int num_frames, int num_channels);
     void (*stream_userdata_cb)(float* buffer, int num_frames, int num_channels, void* user_data);
     void* user_data;
@@ -736,23 +991,128 @@ typedef struct {
     int packet_frames;          /* number of frames in a packet */
     int num_packets;            /* number of packets in packet queue */
     int num_channels;           /* actual number of channels */
+    saudio_format sample_format; /* internal sample format */
+    float* cvt_buffer;          /* stream callback buffer for non-float sample formats */
+    int cvt_buffer_frames;      /* size of cvt_buffer in number of frames */
+    bool offline;               /* true if this stream has no backend device */
+    uint8_t* offline_buffer;    /* render buffer of offline streams */
+    uint64_t offline_frames;    /* number of frames rendered in offline mode */
+    double offline_secs;        /* wall-clock time spent in offline rendering */
     saudio_desc desc;
     _saudio_fifo_t fifo;
     _saudio_backend_t backend;
+} _saudio_stream_t;
+
+/* sokol-audio state */
+typedef struct {
+    bool valid;                 /* true between saudio_setup() and saudio_shutdown() */
+    uint32_t unique_counter;    /* for creating unique stream ids */
+    int num_streams;            /* number of active streams with a backend device */
+    saudio_stream default_stream;
+    _saudio_backend_shared_t backend;
+    _saudio_stream_t streams[SAUDIO_MAX_STREAMS];
 } _saudio_state_t;
 
 static _saudio_state_t _saudio;
 
-_SOKOL_PRIVATE bool _saudio_has_callback(void) {
-    return (_saudio.stream_cb || _saudio.stream_userdata_cb);
+_SOKOL_PRIVATE bool _saudio_has_callback(_saudio_stream_t* stream) {
+    return (stream->stream_cb || stream->stream_userdata_cb);
+}
+
+_SOKOL_PRIVATE void _saudio_stream_callback(_saudio_stream_t* stream, float* buffer, int num_frames, int num_channels) {
+    if (stream->stream_cb) {
+        stream->stream_cb(buffer, num_frames, num_channels);
+    }
+    else if (stream->stream_userdata_cb) {
+        stream->stream_userdata_cb(buffer, num_frames, num_channels, stream->user_data);
+    }
+}
+
+/*=== SAMPLE FORMAT CONVERSION ===============================================*/
+_SOKOL_PRIVATE int _saudio_bytes_per_sample(saudio_format fmt) {
+    switch (fmt) {
+        case SAUDIO_FORMAT_FLOAT:   return (int)sizeof(float);
+        case SAUDIO_FORMAT_S16:     return (int)sizeof(int16_t);
+        default: SOKOL_ASSERT(false); return 0;
+    }
+}
+
+/* convert float samples to 16-bit signed integer samples (clamped to -1.0 .. +1.0) */
+_SOKOL_PRIVATE void _saudio_f32_to_s16(int16_t* dst, const float* src, int num_samples) {
+    int i = 0;
+    #if defined(_SAUDIO_SSE2)
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 lo = _mm_set1_ps(-1.0f);
+    const __m128 hi = _mm_set1_ps(1.0f);
+    for (; (i + 8) <= num_samples; i += 8) {
+        __m128 f0 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo), hi);
+        __m128 f1 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lo), hi);
+        __m128i i0 = _mm_cvttps_epi32(_mm_mul_ps(f0, scale));
+        __m128i i1 = _mm_cvttps_epi32(_mm_mul_ps(f1, scale));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(i0, i1));
+    }
+    #elif defined(_SAUDIO_NEON)
+    const float32x4_t lo = vdupq_n_f32(-1.0f);
+    const float32x4_t hi = vdupq_n_f32(1.0f);
+    for (; (i + 8) <= num_samples; i += 8) {
+        float32x4_t f0 = vminq_f32(vmaxq_f32(vld1q_f32(src + i), lo), hi);
+        float32x4_t f1 = vminq_f32(vmaxq_f32(vld1q_f32(src + i + 4), lo), hi);
+        int32x4_t i0 = vcvtq_s32_f32(vmulq_n_f32(f0, 32767.0f));
+        int32x4_t i1 = vcvtq_s32_f32(vmulq_n_f32(f1, 32767.0f));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(i0), vqmovn_s32(i1)));
+    }
+    #endif
+    for (; i < num_samples; i++) {
+        float f = src[i];
+        f = (f < -1.0f) ? -1.0f : ((f > 1.0f) ? 1.0f : f);
+        dst[i] = (int16_t) (f * 32767.0f);
+    }
 }
 
-_SOKOL_PRIVATE void _saudio_stream_callback(float* buffer, int num_frames, int num_channels) {
-    if (_saudio.stream_cb) {
-        _saudio.stream_cb(buffer, num_frames, num_channels);
+/* convert 16-bit signed integer samples to float samples */
+_SOKOL_PRIVATE void _saudio_s16_to_f32(float* dst, const int16_t* src, int num_samples) {
+    const float scale = 1.0f / 32767.0f;
+    int i = 0;
+    #if defined(_SAUDIO_SSE2)
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128i zero = _mm_setzero_si128();
+    for (; (i + 8) <= num_samples; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        /* sign-extend 16-bit to 32-bit */
+        __m128i sign = _mm_cmpgt_epi16(zero, s);
+        __m128i i0 = _mm_unpacklo_epi16(s, sign);
+        __m128i i1 = _mm_unpackhi_epi16(s, sign);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(i0), vscale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(i1), vscale));
+    }
+    #elif defined(_SAUDIO_NEON)
+    for (; (i + 8) <= num_samples; i += 8) {
+        int16x8_t s = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(s))), scale));
+        vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(s))), scale));
+    }
+    #endif
+    for (; i < num_samples; i++) {
+        dst[i] = (float)src[i] * scale;
     }
-    else if (_saudio.stream_userdata_cb) {
-        _saudio.stream_userdata_cb(buffer, num_frames, num_channels, _saudio.user_data);
+}
+
+/* call the stream callback and write the result in the internal sample format */
+_SOKOL_PRIVATE void _saudio_stream_callback_fmt(_saudio_stream_t* stream, void* buffer, int num_frames) {
+    const int num_channels = stream->num_channels;
+    if (stream->sample_format == SAUDIO_FORMAT_FLOAT) {
+        _saudio_stream_callback(stream, (float*)buffer, num_frames, num_channels);
+    }
+    else {
+        SOKOL_ASSERT(stream->cvt_buffer && (stream->cvt_buffer_frames > 0));
+        int16_t* dst = (int16_t*) buffer;
+        while (num_frames > 0) {
+            const int chunk_frames = (num_frames < stream->cvt_buffer_frames) ? num_frames : stream->cvt_buffer_frames;
+            _saudio_stream_callback(stream, stream->cvt_buffer, chunk_frames, num_channels);
+            _saudio_f32_to_s16(dst, stream->cvt_buffer, chunk_frames * num_channels);
+            dst += chunk_frames * num_channels;
+            num_frames -= chunk_frames;
+        }
     }
 }
 
@@ -978,13 +1338,56 @@ _SOKOL_PRIVATE int _saudio_fifo_read(_saudio_fifo_t* fifo, uint8_t* ptr, int num
     return num_bytes_copied;
 }
 
+/* fill a backend buffer from the stream callback or packet fifo, called by backends */
+_SOKOL_PRIVATE void _saudio_fill_buffer(_saudio_stream_t* stream, void* buffer, int num_frames) {
+    if (_saudio_has_callback(stream)) {
+        _saudio_stream_callback_fmt(stream, buffer, num_frames);
+    }
+    else {
+        const int num_bytes = num_frames * stream->bytes_per_frame;
+        if (0 == _saudio_fifo_read(&stream->fifo, (uint8_t*)buffer, num_bytes)) {
+            /* not enough read data available, fill the entire buffer with silence */
+            memset(buffer, 0, (size_t)num_bytes);
+        }
+    }
+}
+
+/* push sample data in a format different from the internal format, returns num frames pushed */
+_SOKOL_PRIVATE int _saudio_push_converted(_saudio_stream_t* stream, const void* frames, saudio_format src_format, int num_frames) {
+    SOKOL_ASSERT(src_format != stream->sample_format);
+    /* convert through a small stack buffer, float is the bigger format */
+    float cvt_buf[_SAUDIO_CONVERT_CHUNK_SAMPLES];
+    const int num_channels = stream->num_channels;
+    const int max_chunk_frames = _SAUDIO_CONVERT_CHUNK_SAMPLES / num_channels;
+    SOKOL_ASSERT(max_chunk_frames > 0);
+    int frames_pushed = 0;
+    while (frames_pushed < num_frames) {
+        const int left = num_frames - frames_pushed;
+        const int chunk_frames = (left < max_chunk_frames) ? left : max_chunk_frames;
+        const int offset = frames_pushed * num_channels;
+        if (src_format == SAUDIO_FORMAT_FLOAT) {
+            _saudio_f32_to_s16((int16_t*)cvt_buf, ((const float*)frames) + offset, chunk_frames * num_channels);
+        }
+        else {
+            _saudio_s16_to_f32(cvt_buf, ((const int16_t*)frames) + offset, chunk_frames * num_channels);
+        }
+        const int num_bytes = chunk_frames * stream->bytes_per_frame;
+        const int num_written = _saudio_fifo_write(&stream->fifo, (const uint8_t*)cvt_buf, num_bytes);
+        frames_pushed += num_written / stream->bytes_per_frame;
+        if (num_written < num_bytes) {
+            break;
+        }
+    }
+    return frames_pushed;
+}
+
 /*=== DUMMY BACKEND IMPLEMENTATION ===========================================*/
 #if defined(SOKOL_DUMMY_BACKEND)
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
-    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
+    stream->bytes_per_frame = stream->num_channels * _saudio_bytes_per_sample(stream->sample_format);
     return true;
 };
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) { };
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) { (void)stream; };
 
 /*=== COREAUDIO BACKEND IMPLEMENTATION =======================================*/
 #elif defined(__APPLE__)
@@ -1026,12 +1429,20 @@ _SOKOL_PRIVATE void _saudio_backend_shutdown(void) { };
     NSInteger type = [[dict valueForKey:AVAudioSessionInterruptionTypeKey] integerValue];
     switch (type) {
         case AVAudioSessionInterruptionTypeBegan:
-            AudioQueuePause(_saudio.backend.ca_audio_queue);
+            for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+                if (_saudio.streams[i].valid) {
+                    AudioQueuePause(_saudio.streams[i].backend.ca_audio_queue);
+                }
+            }
             [session setActive:false error:nil];
             break;
         case AVAudioSessionInterruptionTypeEnded:
             [session setActive:true error:nil];
-            AudioQueueStart(_saudio.backend.ca_audio_queue, NULL);
+            for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+                if (_saudio.streams[i].valid) {
+                    AudioQueueStart(_saudio.streams[i].backend.ca_audio_queue, NULL);
+                }
+            }
             break;
         default:
             break;
@@ -1042,86 +1453,86 @@ _SOKOL_PRIVATE void _saudio_backend_shutdown(void) { };
 
 /* NOTE: the buffer data callback is called on a separate thread! */
 _SOKOL_PRIVATE void _saudio_coreaudio_callback(void* user_data, AudioQueueRef queue, AudioQueueBufferRef buffer) {
-    _SOKOL_UNUSED(user_data);
-    if (_saudio_has_callback()) {
-        const int num_frames = (int)buffer->mAudioDataByteSize / _saudio.bytes_per_frame;
-        const int num_channels = _saudio.num_channels;
-        _saudio_stream_callback((float*)buffer->mAudioData, num_frames, num_channels);
-    }
-    else {
-        uint8_t* ptr = (uint8_t*)buffer->mAudioData;
-        int num_bytes = (int) buffer->mAudioDataByteSize;
-        if (0 == _saudio_fifo_read(&_saudio.fifo, ptr, num_bytes)) {
-            /* not enough read data available, fill the entire buffer with silence */
-            memset(ptr, 0, (size_t)num_bytes);
-        }
-    }
+    _saudio_stream_t* stream = (_saudio_stream_t*) user_data;
+    const int num_frames = (int)buffer->mAudioDataByteSize / stream->bytes_per_frame;
+    _saudio_fill_buffer(stream, buffer->mAudioData, num_frames);
     AudioQueueEnqueueBuffer(queue, buffer, 0, NULL);
 }
 
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
-    SOKOL_ASSERT(0 == _saudio.backend.ca_audio_queue);
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
+    SOKOL_ASSERT(0 == stream->backend.ca_audio_queue);
 
     #if TARGET_OS_IOS
-    /* activate audio session */
-    AVAudioSession* session = [AVAudioSession sharedInstance];
-    SOKOL_ASSERT(session != nil);
-    [session setCategory: AVAudioSessionCategoryPlayback withOptions:AVAudioSessionCategoryOptionDefaultToSpeaker error:nil];
-    [session setActive:true error:nil];
+    /* activate audio session with the first stream */
+    if (0 == _saudio.num_streams) {
+        AVAudioSession* session = [AVAudioSession sharedInstance];
+        SOKOL_ASSERT(session != nil);
+        [session setCategory: AVAudioSessionCategoryPlayback withOptions:AVAudioSessionCategoryOptionDefaultToSpeaker error:nil];
+        [session setActive:true error:nil];
 
-    /* create interruption handler */
-    _saudio.backend.ca_interruption_handler = [[_saudio_interruption_handler alloc] init];
+        /* create interruption handler */
+        _saudio.backend.ca_interruption_handler = [[_saudio_interruption_handler alloc] init];
+    }
     #endif
 
-    /* create an audio queue with fp32 samples */
+    /* create an audio queue with fp32 or int16 samples */
+    const uint32_t bytes_per_sample = (uint32_t)_saudio_bytes_per_sample(stream->sample_format);
     AudioStreamBasicDescription fmt;
     memset(&fmt, 0, sizeof(fmt));
-    fmt.mSampleRate = (Float64) _saudio.sample_rate;
+    fmt.mSampleRate = (Float64) stream->sample_rate;
     fmt.mFormatID = kAudioFormatLinearPCM;
-    fmt.mFormatFlags = kLinearPCMFormatFlagIsFloat | kAudioFormatFlagIsPacked;
+    if (stream->sample_format == SAUDIO_FORMAT_S16) {
+        fmt.mFormatFlags = kLinearPCMFormatFlagIsSignedInteger | kAudioFormatFlagIsPacked;
+    }
+    else {
+        fmt.mFormatFlags = kLinearPCMFormatFlagIsFloat | kAudioFormatFlagIsPacked;
+    }
     fmt.mFramesPerPacket = 1;
-    fmt.mChannelsPerFrame = (uint32_t) _saudio.num_channels;
-    fmt.mBytesPerFrame = (uint32_t)sizeof(float) * (uint32_t)_saudio.num_channels;
+    fmt.mChannelsPerFrame = (uint32_t) stream->num_channels;
+    fmt.mBytesPerFrame = bytes_per_sample * (uint32_t)stream->num_channels;
     fmt.mBytesPerPacket = fmt.mBytesPerFrame;
-    fmt.mBitsPerChannel = 32;
-    OSStatus res = AudioQueueNewOutput(&fmt, _saudio_coreaudio_callback, 0, NULL, NULL, 0, &_saudio.backend.ca_audio_queue);
-    SOKOL_ASSERT((res == 0) && _saudio.backend.ca_audio_queue);
+    fmt.mBitsPerChannel = bytes_per_sample * 8;
+    OSStatus res = AudioQueueNewOutput(&fmt, _saudio_coreaudio_callback, stream, NULL, NULL, 0, &stream->backend.ca_audio_queue);
+    SOKOL_ASSERT((res == 0) && stream->backend.ca_audio_queue);
 
     /* create 2 audio buffers */
     for (int i = 0; i < 2; i++) {
         AudioQueueBufferRef buf = NULL;
-        const uint32_t buf_byte_size = (uint32_t)_saudio.buffer_frames * fmt.mBytesPerFrame;
-        res = AudioQueueAllocateBuffer(_saudio.backend.ca_audio_queue, buf_byte_size, &buf);
+        const uint32_t buf_byte_size = (uint32_t)stream->buffer_frames * fmt.mBytesPerFrame;
+        res = AudioQueueAllocateBuffer(stream->backend.ca_audio_queue, buf_byte_size, &buf);
         SOKOL_ASSERT((res == 0) && buf);
         buf->mAudioDataByteSize = buf_byte_size;
         memset(buf->mAudioData, 0, buf->mAudioDataByteSize);
-        AudioQueueEnqueueBuffer(_saudio.backend.ca_audio_queue, buf, 0, NULL);
+        AudioQueueEnqueueBuffer(stream->backend.ca_audio_queue, buf, 0, NULL);
     }
 
     /* init or modify actual playback parameters */
-    _saudio.bytes_per_frame = (int)fmt.mBytesPerFrame;
+    stream->bytes_per_frame = (int)fmt.mBytesPerFrame;
 
     /* ...and start playback */
-    res = AudioQueueStart(_saudio.backend.ca_audio_queue, NULL);
+    res = AudioQueueStart(stream->backend.ca_audio_queue, NULL);
     SOKOL_ASSERT(0 == res);
 
     return true;
 }
 
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
-    AudioQueueStop(_saudio.backend.ca_audio_queue, true);
-    AudioQueueDispose(_saudio.backend.ca_audio_queue, false);
-    _saudio.backend.ca_audio_queue = NULL;
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) {
+    AudioQueueStop(stream->backend.ca_audio_queue, true);
+    AudioQueueDispose(stream->backend.ca_audio_queue, false);
+    stream->backend.ca_audio_queue = NULL;
     #if TARGET_OS_IOS
-    /* remove interruption handler */
-    if (_saudio.backend.ca_interruption_handler != nil) {
-        [_saudio.backend.ca_interruption_handler remove_handler];
-        _SAUDIO_OBJC_RELEASE(_saudio.backend.ca_interruption_handler);
+    /* the audio session is deactivated with the last stream */
+    if (0 == _saudio.num_streams) {
+        /* remove interruption handler */
+        if (_saudio.backend.ca_interruption_handler != nil) {
+            [_saudio.backend.ca_interruption_handler remove_handler];
+            _SAUDIO_OBJC_RELEASE(_saudio.backend.ca_interruption_handler);
+        }
+        /* deactivate audio session */
+        AVAudioSession* session = [AVAudioSession sharedInstance];
+        SOKOL_ASSERT(session);
+        [session setActive:false error:nil];;
     }
-    /* deactivate audio session */
-    AVAudioSession* session = [AVAudioSession sharedInstance];
-    SOKOL_ASSERT(session);
-    [session setActive:false error:nil];;
     #endif
 }
 
@@ -1130,33 +1541,25 @@ _SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
 
 /* the streaming callback runs in a separate thread */
 _SOKOL_PRIVATE void* _saudio_alsa_cb(void* param) {
-    _SOKOL_UNUSED(param);
-    while (!_saudio.backend.thread_stop) {
+    _saudio_stream_t* stream = (_saudio_stream_t*) param;
+    while (!stream->backend.thread_stop) {
         /* snd_pcm_writei() will be blocking until it needs data */
-        int write_res = snd_pcm_writei(_saudio.backend.device, _saudio.backend.buffer, (snd_pcm_uframes_t)_saudio.backend.buffer_frames);
+        int write_res = snd_pcm_writei(stream->backend.device, stream->backend.buffer, (snd_pcm_uframes_t)stream->backend.buffer_frames);
         if (write_res < 0) {
             /* underrun occurred */
-            snd_pcm_prepare(_saudio.backend.device);
+            snd_pcm_prepare(stream->backend.device);
         }
         else {
             /* fill the streaming buffer with new data */
-            if (_saudio_has_callback()) {
-                _saudio_stream_callback(_saudio.backend.buffer, _saudio.backend.buffer_frames, _saudio.num_channels);
-            }
-            else {
-                if (0 == _saudio_fifo_read(&_saudio.fifo, (uint8_t*)_saudio.backend.buffer, _saudio.backend.buffer_byte_size)) {
-                    /* not enough read data available, fill the entire buffer with silence */
-                    memset(_saudio.backend.buffer, 0, (size_t)_saudio.backend.buffer_byte_size);
-                }
-            }
+            _saudio_fill_buffer(stream, stream->backend.buffer, stream->backend.buffer_frames);
         }
     }
     return 0;
 }
 
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
     int dir; uint32_t rate;
-    int rc = snd_pcm_open(&_saudio.backend.device, "default", SND_PCM_STREAM_PLAYBACK, 0);
+    int rc = snd_pcm_open(&stream->backend.device, "default", SND_PCM_STREAM_PLAYBACK, 0);
     if (rc < 0) {
         SOKOL_LOG("sokol_audio.h: snd_pcm_open() failed");
         return false;
@@ -1168,64 +1571,70 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     */
     snd_pcm_hw_params_t* params = 0;
     snd_pcm_hw_params_alloca(&params);
-    snd_pcm_hw_params_any(_saudio.backend.device, params);
-    snd_pcm_hw_params_set_access(_saudio.backend.device, params, SND_PCM_ACCESS_RW_INTERLEAVED);
-    if (0 > snd_pcm_hw_params_set_format(_saudio.backend.device, params, SND_PCM_FORMAT_FLOAT_LE)) {
+    snd_pcm_hw_params_any(stream->backend.device, params);
+    snd_pcm_hw_params_set_access(stream->backend.device, params, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (stream->sample_format == SAUDIO_FORMAT_S16) {
+        if (0 > snd_pcm_hw_params_set_format(stream->backend.device, params, SND_PCM_FORMAT_S16_LE)) {
+            SOKOL_LOG("sokol_audio.h: int16 samples not supported");
+            goto error;
+        }
+    }
+    else if (0 > snd_pcm_hw_params_set_format(stream->backend.device, params, SND_PCM_FORMAT_FLOAT_LE)) {
         SOKOL_LOG("sokol_audio.h: float samples not supported");
         goto error;
     }
-    if (0 > snd_pcm_hw_params_set_buffer_size(_saudio.backend.device, params, (snd_pcm_uframes_t)_saudio.buffer_frames)) {
+    if (0 > snd_pcm_hw_params_set_buffer_size(stream->backend.device, params, (snd_pcm_uframes_t)stream->buffer_frames)) {
         SOKOL_LOG("sokol_audio.h: requested buffer size not supported");
         goto error;
     }
-    if (0 > snd_pcm_hw_params_set_channels(_saudio.backend.device, params, (uint32_t)_saudio.num_channels)) {
+    if (0 > snd_pcm_hw_params_set_channels(stream->backend.device, params, (uint32_t)stream->num_channels)) {
         SOKOL_LOG("sokol_audio.h: requested channel count not supported");
         goto error;
     }
     /* let ALSA pick a nearby sampling rate */
-    rate = (uint32_t) _saudio.sample_rate;
+    rate = (uint32_t) stream->sample_rate;
     dir = 0;
-    if (0 > snd_pcm_hw_params_set_rate_near(_saudio.backend.device, params, &rate, &dir)) {
+    if (0 > snd_pcm_hw_params_set_rate_near(stream->backend.device, params, &rate, &dir)) {
         SOKOL_LOG("sokol_audio.h: snd_pcm_hw_params_set_rate_near() failed");
         goto error;
     }
-    if (0 > snd_pcm_hw_params(_saudio.backend.device, params)) {
+    if (0 > snd_pcm_hw_params(stream->backend.device, params)) {
         SOKOL_LOG("sokol_audio.h: snd_pcm_hw_params() failed");
         goto error;
     }
 
     /* read back actual sample rate and channels */
-    _saudio.sample_rate = (int)rate;
-    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
+    stream->sample_rate = (int)rate;
+    stream->bytes_per_frame = stream->num_channels * _saudio_bytes_per_sample(stream->sample_format);
 
     /* allocate the streaming buffer */
-    _saudio.backend.buffer_byte_size = _saudio.buffer_frames * _saudio.bytes_per_frame;
-    _saudio.backend.buffer_frames = _saudio.buffer_frames;
-    _saudio.backend.buffer = (float*) SOKOL_MALLOC((size_t)_saudio.backend.buffer_byte_size);
-    memset(_saudio.backend.buffer, 0, (size_t)_saudio.backend.buffer_byte_size);
+    stream->backend.buffer_byte_size = stream->buffer_frames * stream->bytes_per_frame;
+    stream->backend.buffer_frames = stream->buffer_frames;
+    stream->backend.buffer = SOKOL_MALLOC((size_t)stream->backend.buffer_byte_size);
+    memset(stream->backend.buffer, 0, (size_t)stream->backend.buffer_byte_size);
 
     /* create the buffer-streaming start thread */
-    if (0 != pthread_create(&_saudio.backend.thread, 0, _saudio_alsa_cb, 0)) {
+    if (0 != pthread_create(&stream->backend.thread, 0, _saudio_alsa_cb, stream)) {
         SOKOL_LOG("sokol_audio.h: pthread_create() failed");
         goto error;
     }
 
     return true;
 error:
-    if (_saudio.backend.device) {
-        snd_pcm_close(_saudio.backend.device);
-        _saudio.backend.device = 0;
+    if (stream->backend.device) {
+        snd_pcm_close(stream->backend.device);
+        stream->backend.device = 0;
     }
     return false;
 };
 
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
-    SOKOL_ASSERT(_saudio.backend.device);
-    _saudio.backend.thread_stop = true;
-    pthread_join(_saudio.backend.thread, 0);
-    snd_pcm_drain(_saudio.backend.device);
-    snd_pcm_close(_saudio.backend.device);
-    SOKOL_FREE(_saudio.backend.buffer);
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) {
+    SOKOL_ASSERT(stream->backend.device);
+    stream->backend.thread_stop = true;
+    pthread_join(stream->backend.thread, 0);
+    snd_pcm_drain(stream->backend.device);
+    snd_pcm_close(stream->backend.device);
+    SOKOL_FREE(stream->backend.buffer);
 };
 
 /*=== WASAPI BACKEND IMPLEMENTATION ==========================================*/
@@ -1261,117 +1670,117 @@ _SOKOL_PRIVATE ULONG STDMETHODCALLTYPE _saudio_interface_completion_handler_addr
 
 _SOKOL_PRIVATE HRESULT STDMETHODCALLTYPE _saudio_backend_activate_audio_interface_cb(IActivateAudioInterfaceCompletionHandler* instance, IActivateAudioInterfaceAsyncOperation* activateOperation) {
     _SOKOL_UNUSED(instance);
-    WaitForSingleObject(_saudio.backend.interface_activation_mutex, INFINITE);
-    _saudio.backend.interface_activation_success = TRUE;
+    /* streams are created one after another, so there's only one activation in flight */
+    _saudio_backend_t* backend = _saudio.backend.activating_backend;
+    SOKOL_ASSERT(backend);
+    WaitForSingleObject(backend->interface_activation_mutex, INFINITE);
+    backend->interface_activation_success = TRUE;
     HRESULT activation_result;
-    if (FAILED(activateOperation->lpVtbl->GetActivateResult(activateOperation, &activation_result, (IUnknown**)(&_saudio.backend.audio_client))) || FAILED(activation_result)) {
-        _saudio.backend.interface_activation_success = FALSE;
+    if (FAILED(activateOperation->lpVtbl->GetActivateResult(activateOperation, &activation_result, (IUnknown**)(&backend->audio_client))) || FAILED(activation_result)) {
+        backend->interface_activation_success = FALSE;
     }
 
-    ReleaseMutex(_saudio.backend.interface_activation_mutex);
+    ReleaseMutex(backend->interface_activation_mutex);
     return S_OK;
 }
 #endif
 
-/* fill intermediate buffer with new data and reset buffer_pos */
-_SOKOL_PRIVATE void _saudio_wasapi_fill_buffer(void) {
-    if (_saudio_has_callback()) {
-        _saudio_stream_callback(_saudio.backend.thread.src_buffer, _saudio.backend.thread.src_buffer_frames, _saudio.num_channels);
-    }
-    else {
-        if (0 == _saudio_fifo_read(&_saudio.fifo, (uint8_t*)_saudio.backend.thread.src_buffer, _saudio.backend.thread.src_buffer_byte_size)) {
-            /* not enough read data available, fill the entire buffer with silence */
-            memset(_saudio.backend.thread.src_buffer, 0, (size_t)_saudio.backend.thread.src_buffer_byte_size);
-        }
-    }
-}
-
-_SOKOL_PRIVATE void _saudio_wasapi_submit_buffer(int num_frames) {
+_SOKOL_PRIVATE void _saudio_wasapi_submit_buffer(_saudio_stream_t* stream, int num_frames) {
     BYTE* wasapi_buffer = 0;
-    if (FAILED(IAudioRenderClient_GetBuffer(_saudio.backend.render_client, num_frames, &wasapi_buffer))) {
+    if (FAILED(IAudioRenderClient_GetBuffer(stream->backend.render_client, num_frames, &wasapi_buffer))) {
         return;
     }
     SOKOL_ASSERT(wasapi_buffer);
 
-    /* convert float samples to int16_t, refill float buffer if needed */
-    const int num_samples = num_frames * _saudio.num_channels;
+    /* copy or convert samples to int16_t, refill the source buffer if needed */
+    int num_samples = num_frames * stream->num_channels;
     int16_t* dst = (int16_t*) wasapi_buffer;
-    int buffer_pos = _saudio.backend.thread.src_buffer_pos;
-    const int buffer_float_size = _saudio.backend.thread.src_buffer_byte_size / (int)sizeof(float);
-    float* src = _saudio.backend.thread.src_buffer;
-    for (int i = 0; i < num_samples; i++) {
+    int buffer_pos = stream->backend.thread.src_buffer_pos;
+    const int buffer_num_samples = stream->backend.thread.src_buffer_frames * stream->num_channels;
+    while (num_samples > 0) {
         if (0 == buffer_pos) {
-            _saudio_wasapi_fill_buffer();
+            _saudio_fill_buffer(stream, stream->backend.thread.src_buffer, stream->backend.thread.src_buffer_frames);
         }
-        dst[i] = (int16_t) (src[buffer_pos] * 0x7FFF);
-        buffer_pos += 1;
-        if (buffer_pos == buffer_float_size) {
+        const int left = buffer_num_samples - buffer_pos;
+        const int to_copy = (num_samples < left) ? num_samples : left;
+        if (stream->sample_format == SAUDIO_FORMAT_S16) {
+            const int16_t* src = ((const int16_t*)stream->backend.thread.src_buffer) + buffer_pos;
+            memcpy(dst, src, (size_t)to_copy * sizeof(int16_t));
+        }
+        else {
+            const float* src = ((const float*)stream->backend.thread.src_buffer) + buffer_pos;
+            _saudio_f32_to_s16(dst, src, to_copy);
+        }
+        dst += to_copy;
+        num_samples -= to_copy;
+        buffer_pos += to_copy;
+        if (buffer_pos == buffer_num_samples) {
             buffer_pos = 0;
         }
     }
-    _saudio.backend.thread.src_buffer_pos = buffer_pos;
+    stream->backend.thread.src_buffer_pos = buffer_pos;
 
-    IAudioRenderClient_ReleaseBuffer(_saudio.backend.render_client, num_frames, 0);
+    IAudioRenderClient_ReleaseBuffer(stream->backend.render_client, num_frames, 0);
 }
 
 _SOKOL_PRIVATE DWORD WINAPI _saudio_wasapi_thread_fn(LPVOID param) {
-    (void)param;
-    _saudio_wasapi_submit_buffer(_saudio.backend.thread.src_buffer_frames);
-    IAudioClient_Start(_saudio.backend.audio_client);
-    while (!_saudio.backend.thread.stop) {
-        WaitForSingleObject(_saudio.backend.thread.buffer_end_event, INFINITE);
+    _saudio_stream_t* stream = (_saudio_stream_t*) param;
+    _saudio_wasapi_submit_buffer(stream, stream->backend.thread.src_buffer_frames);
+    IAudioClient_Start(stream->backend.audio_client);
+    while (!stream->backend.thread.stop) {
+        WaitForSingleObject(stream->backend.thread.buffer_end_event, INFINITE);
         UINT32 padding = 0;
-        if (FAILED(IAudioClient_GetCurrentPadding(_saudio.backend.audio_client, &padding))) {
+        if (FAILED(IAudioClient_GetCurrentPadding(stream->backend.audio_client, &padding))) {
             continue;
         }
-        SOKOL_ASSERT(_saudio.backend.thread.dst_buffer_frames >= padding);
-        int num_frames = (int)_saudio.backend.thread.dst_buffer_frames - (int)padding;
+        SOKOL_ASSERT(stream->backend.thread.dst_buffer_frames >= padding);
+        int num_frames = (int)stream->backend.thread.dst_buffer_frames - (int)padding;
         if (num_frames > 0) {
-            _saudio_wasapi_submit_buffer(num_frames);
+            _saudio_wasapi_submit_buffer(stream, num_frames);
         }
     }
     return 0;
 }
 
-_SOKOL_PRIVATE void _saudio_wasapi_release(void) {
-    if (_saudio.backend.thread.src_buffer) {
-        SOKOL_FREE(_saudio.backend.thread.src_buffer);
-        _saudio.backend.thread.src_buffer = 0;
+_SOKOL_PRIVATE void _saudio_wasapi_release(_saudio_stream_t* stream) {
+    if (stream->backend.thread.src_buffer) {
+        SOKOL_FREE(stream->backend.thread.src_buffer);
+        stream->backend.thread.src_buffer = 0;
     }
-    if (_saudio.backend.render_client) {
-        IAudioRenderClient_Release(_saudio.backend.render_client);
-        _saudio.backend.render_client = 0;
+    if (stream->backend.render_client) {
+        IAudioRenderClient_Release(stream->backend.render_client);
+        stream->backend.render_client = 0;
     }
-    if (_saudio.backend.audio_client) {
-        IAudioClient_Release(_saudio.backend.audio_client);
-        _saudio.backend.audio_client = 0;
+    if (stream->backend.audio_client) {
+        IAudioClient_Release(stream->backend.audio_client);
+        stream->backend.audio_client = 0;
     }
 #if defined(SOKOL_WIN32_NO_MMDEVICE)
-    if (_saudio.backend.interface_activation_audio_interface_uid_string) {
-        CoTaskMemFree(_saudio.backend.interface_activation_audio_interface_uid_string);
-        _saudio.backend.interface_activation_audio_interface_uid_string = 0;
+    if (stream->backend.interface_activation_audio_interface_uid_string) {
+        CoTaskMemFree(stream->backend.interface_activation_audio_interface_uid_string);
+        stream->backend.interface_activation_audio_interface_uid_string = 0;
     }
-    if (_saudio.backend.interface_activation_operation) {
-        IActivateAudioInterfaceAsyncOperation_Release(_saudio.backend.interface_activation_operation);
-        _saudio.backend.interface_activation_operation = 0;
+    if (stream->backend.interface_activation_operation) {
+        IActivateAudioInterfaceAsyncOperation_Release(stream->backend.interface_activation_operation);
+        stream->backend.interface_activation_operation = 0;
     }
 #else
-    if (_saudio.backend.device) {
-        IMMDevice_Release(_saudio.backend.device);
-        _saudio.backend.device = 0;
+    if (stream->backend.device) {
+        IMMDevice_Release(stream->backend.device);
+        stream->backend.device = 0;
     }
-    if (_saudio.backend.device_enumerator) {
-        IMMDeviceEnumerator_Release(_saudio.backend.device_enumerator);
-        _saudio.backend.device_enumerator = 0;
+    if (stream->backend.device_enumerator) {
+        IMMDeviceEnumerator_Release(stream->backend.device_enumerator);
+        stream->backend.device_enumerator = 0;
     }
 #endif
-    if (0 != _saudio.backend.thread.buffer_end_event) {
-        CloseHandle(_saudio.backend.thread.buffer_end_event);
-        _saudio.backend.thread.buffer_end_event = 0;
+    if (0 != stream->backend.thread.buffer_end_event) {
+        CloseHandle(stream->backend.thread.buffer_end_event);
+        stream->backend.thread.buffer_end_event = 0;
     }
 }
 
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
     REFERENCE_TIME dur;
     /* UWP Threads are CoInitialized by default with a different threading model, and this call fails
     See https://github.com/Microsoft/cppwinrt/issues/6#issuecomment-253930637 */
@@ -1383,18 +1792,18 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     HRESULT hr = CoInitializeEx(0, COINIT_MULTITHREADED);
     _SOKOL_UNUSED(hr);
 #endif
-    _saudio.backend.thread.buffer_end_event = CreateEvent(0, FALSE, FALSE, 0);
-    if (0 == _saudio.backend.thread.buffer_end_event) {
+    stream->backend.thread.buffer_end_event = CreateEvent(0, FALSE, FALSE, 0);
+    if (0 == stream->backend.thread.buffer_end_event) {
         SOKOL_LOG("sokol_audio wasapi: failed to create buffer_end_event");
         goto error;
     }
 #if defined(SOKOL_WIN32_NO_MMDEVICE)
-    _saudio.backend.interface_activation_mutex = CreateMutexA(NULL, FALSE, "interface_activation_mutex");
-    if (_saudio.backend.interface_activation_mutex == NULL) {
+    stream->backend.interface_activation_mutex = CreateMutexA(NULL, FALSE, "interface_activation_mutex");
+    if (stream->backend.interface_activation_mutex == NULL) {
         SOKOL_LOG("sokol_audio wasapi: failed to create interface activation mutex");
         goto error;
     }
-    if (FAILED(StringFromIID(_SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_Devinterface_Audio_Render), &_saudio.backend.interface_activation_audio_interface_uid_string))) {
+    if (FAILED(StringFromIID(_SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_Devinterface_Audio_Render), &stream->backend.interface_activation_audio_interface_uid_string))) {
         SOKOL_LOG("sokol_audio wasapi: failed to get default audio device ID string");
         goto error;
     }
@@ -1408,17 +1817,20 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     };
     static IActivateAudioInterfaceCompletionHandler completion_handler_interface = { &completion_handler_interface_vtable };
 
-    if (FAILED(ActivateAudioInterfaceAsync(_saudio.backend.interface_activation_audio_interface_uid_string, _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient), NULL, &completion_handler_interface, &_saudio.backend.interface_activation_operation))) {
+    _saudio.backend.activating_backend = &stream->backend;
+    if (FAILED(ActivateAudioInterfaceAsync(stream->backend.interface_activation_audio_interface_uid_string, _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient), NULL, &completion_handler_interface, &stream->backend.interface_activation_operation))) {
         SOKOL_LOG("sokol_audio wasapi: failed to get default audio device ID string");
+        _saudio.backend.activating_backend = 0;
         goto error;
     }
-    while (!(_saudio.backend.audio_client)) {
-        if (WaitForSingleObject(_saudio.backend.interface_activation_mutex, 10) != WAIT_TIMEOUT) {
-            ReleaseMutex(_saudio.backend.interface_activation_mutex);
+    while (!(stream->backend.audio_client)) {
+        if (WaitForSingleObject(stream->backend.interface_activation_mutex, 10) != WAIT_TIMEOUT) {
+            ReleaseMutex(stream->backend.interface_activation_mutex);
         }
     }
+    _saudio.backend.activating_backend = 0;
 
-    if (!(_saudio.backend.interface_activation_success)) {
+    if (!(stream->backend.interface_activation_success)) {
         SOKOL_LOG("sokol_audio wasapi: interface activation failed. Unable to get audio client");
         goto error;
     }
@@ -1427,22 +1839,22 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     if (FAILED(CoCreateInstance(_SOKOL_AUDIO_WIN32COM_ID(_saudio_CLSID_IMMDeviceEnumerator),
         0, CLSCTX_ALL,
         _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IMMDeviceEnumerator),
-        (void**)&_saudio.backend.device_enumerator)))
+        (void**)&stream->backend.device_enumerator)))
     {
         SOKOL_LOG("sokol_audio wasapi: failed to create device enumerator");
         goto error;
     }
-    if (FAILED(IMMDeviceEnumerator_GetDefaultAudioEndpoint(_saudio.backend.device_enumerator,
+    if (FAILED(IMMDeviceEnumerator_GetDefaultAudioEndpoint(stream->backend.device_enumerator,
         eRender, eConsole,
-        &_saudio.backend.device)))
+        &stream->backend.device)))
     {
         SOKOL_LOG("sokol_audio wasapi: GetDefaultAudioEndPoint failed");
         goto error;
     }
-    if (FAILED(IMMDevice_Activate(_saudio.backend.device,
+    if (FAILED(IMMDevice_Activate(stream->backend.device,
         _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioClient),
         CLSCTX_ALL, 0,
-        (void**)&_saudio.backend.audio_client)))
+        (void**)&stream->backend.audio_client)))
     {
         SOKOL_LOG("sokol_audio wasapi: device activate failed");
         goto error;
@@ -1450,15 +1862,15 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
 #endif
     WAVEFORMATEX fmt;
     memset(&fmt, 0, sizeof(fmt));
-    fmt.nChannels = (WORD)_saudio.num_channels;
-    fmt.nSamplesPerSec = (DWORD)_saudio.sample_rate;
+    fmt.nChannels = (WORD)stream->num_channels;
+    fmt.nSamplesPerSec = (DWORD)stream->sample_rate;
     fmt.wFormatTag = WAVE_FORMAT_PCM;
     fmt.wBitsPerSample = 16;
     fmt.nBlockAlign = (fmt.nChannels * fmt.wBitsPerSample) / 8;
     fmt.nAvgBytesPerSec = fmt.nSamplesPerSec * fmt.nBlockAlign;
     dur = (REFERENCE_TIME)
-        (((double)_saudio.buffer_frames) / (((double)_saudio.sample_rate) * (1.0/10000000.0)));
-    if (FAILED(IAudioClient_Initialize(_saudio.backend.audio_client,
+        (((double)stream->buffer_frames) / (((double)stream->sample_rate) * (1.0/10000000.0)));
+    if (FAILED(IAudioClient_Initialize(stream->backend.audio_client,
         AUDCLNT_SHAREMODE_SHARED,
         AUDCLNT_STREAMFLAGS_EVENTCALLBACK|AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM|AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
         dur, 0, &fmt, 0)))
@@ -1466,54 +1878,54 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
         SOKOL_LOG("sokol_audio wasapi: audio client initialize failed");
         goto error;
     }
-    if (FAILED(IAudioClient_GetBufferSize(_saudio.backend.audio_client, &_saudio.backend.thread.dst_buffer_frames))) {
+    if (FAILED(IAudioClient_GetBufferSize(stream->backend.audio_client, &stream->backend.thread.dst_buffer_frames))) {
         SOKOL_LOG("sokol_audio wasapi: audio client get buffer size failed");
         goto error;
     }
-    if (FAILED(IAudioClient_GetService(_saudio.backend.audio_client,
+    if (FAILED(IAudioClient_GetService(stream->backend.audio_client,
         _SOKOL_AUDIO_WIN32COM_ID(_saudio_IID_IAudioRenderClient),
-        (void**)&_saudio.backend.render_client)))
+        (void**)&stream->backend.render_client)))
     {
         SOKOL_LOG("sokol_audio wasapi: audio client GetService failed");
         goto error;
     }
-    if (FAILED(IAudioClient_SetEventHandle(_saudio.backend.audio_client, _saudio.backend.thread.buffer_end_event))) {
+    if (FAILED(IAudioClient_SetEventHandle(stream->backend.audio_client, stream->backend.thread.buffer_end_event))) {
         SOKOL_LOG("sokol_audio wasapi: audio client SetEventHandle failed");
         goto error;
     }
-    _saudio.backend.si16_bytes_per_frame = _saudio.num_channels * (int)sizeof(int16_t);
-    _saudio.bytes_per_frame = _saudio.num_channels * (int)sizeof(float);
-    _saudio.backend.thread.src_buffer_frames = _saudio.buffer_frames;
-    _saudio.backend.thread.src_buffer_byte_size = _saudio.backend.thread.src_buffer_frames * _saudio.bytes_per_frame;
+    stream->backend.si16_bytes_per_frame = stream->num_channels * (int)sizeof(int16_t);
+    stream->bytes_per_frame = stream->num_channels * _saudio_bytes_per_sample(stream->sample_format);
+    stream->backend.thread.src_buffer_frames = stream->buffer_frames;
+    stream->backend.thread.src_buffer_byte_size = stream->backend.thread.src_buffer_frames * stream->bytes_per_frame;
 
     /* allocate an intermediate buffer for sample format conversion */
-    _saudio.backend.thread.src_buffer = (float*) SOKOL_MALLOC((size_t)_saudio.backend.thread.src_buffer_byte_size);
-    SOKOL_ASSERT(_saudio.backend.thread.src_buffer);
+    stream->backend.thread.src_buffer = SOKOL_MALLOC((size_t)stream->backend.thread.src_buffer_byte_size);
+    SOKOL_ASSERT(stream->backend.thread.src_buffer);
 
     /* create streaming thread */
-    _saudio.backend.thread.thread_handle = CreateThread(NULL, 0, _saudio_wasapi_thread_fn, 0, 0, 0);
-    if (0 == _saudio.backend.thread.thread_handle) {
+    stream->backend.thread.thread_handle = CreateThread(NULL, 0, _saudio_wasapi_thread_fn, stream, 0, 0);
+    if (0 == stream->backend.thread.thread_handle) {
         SOKOL_LOG("sokol_audio wasapi: CreateThread failed");
         goto error;
     }
     return true;
 error:
-    _saudio_wasapi_release();
+    _saudio_wasapi_release(stream);
     return false;
 }
 
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
-    if (_saudio.backend.thread.thread_handle) {
-        _saudio.backend.thread.stop = true;
-        SetEvent(_saudio.backend.thread.buffer_end_event);
-        WaitForSingleObject(_saudio.backend.thread.thread_handle, INFINITE);
-        CloseHandle(_saudio.backend.thread.thread_handle);
-        _saudio.backend.thread.thread_handle = 0;
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) {
+    if (stream->backend.thread.thread_handle) {
+        stream->backend.thread.stop = true;
+        SetEvent(stream->backend.thread.buffer_end_event);
+        WaitForSingleObject(stream->backend.thread.thread_handle, INFINITE);
+        CloseHandle(stream->backend.thread.thread_handle);
+        stream->backend.thread.thread_handle = 0;
     }
-    if (_saudio.backend.audio_client) {
-        IAudioClient_Stop(_saudio.backend.audio_client);
+    if (stream->backend.audio_client) {
+        IAudioClient_Stop(stream->backend.audio_client);
     }
-    _saudio_wasapi_release();
+    _saudio_wasapi_release(stream);
 
 #if (defined(WINAPI_FAMILY_PARTITION) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP))
     CoUninitialize();
@@ -1527,20 +1939,13 @@ _SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
 extern "C" {
 #endif
 
-EMSCRIPTEN_KEEPALIVE int _saudio_emsc_pull(int num_frames) {
-    SOKOL_ASSERT(_saudio.backend.buffer);
-    if (num_frames == _saudio.buffer_frames) {
-        if (_saudio_has_callback()) {
-            _saudio_stream_callback((float*)_saudio.backend.buffer, num_frames, _saudio.num_channels);
-        }
-        else {
-            const int num_bytes = num_frames * _saudio.bytes_per_frame;
-            if (0 == _saudio_fifo_read(&_saudio.fifo, _saudio.backend.buffer, num_bytes)) {
-                /* not enough read data available, fill the entire buffer with silence */
-                memset(_saudio.backend.buffer, 0, (size_t)num_bytes);
-            }
-        }
-        int res = (int) _saudio.backend.buffer;
+EMSCRIPTEN_KEEPALIVE int _saudio_emsc_pull(int slot_index, int num_frames) {
+    SOKOL_ASSERT((slot_index >= 0) && (slot_index < SAUDIO_MAX_STREAMS));
+    _saudio_stream_t* stream = &_saudio.streams[slot_index];
+    SOKOL_ASSERT(stream->backend.buffer);
+    if (num_frames == stream->buffer_frames) {
+        _saudio_fill_buffer(stream, stream->backend.buffer, num_frames);
+        int res = (int) stream->backend.buffer;
         return res;
     }
     else {
@@ -1552,50 +1957,57 @@ EMSCRIPTEN_KEEPALIVE int _saudio_emsc_pull(int num_frames) {
 } /* extern "C" */
 #endif
 
-/* setup the WebAudio context and attach a ScriptProcessorNode */
-EM_JS(int, saudio_js_init, (int sample_rate, int num_channels, int buffer_size), {
-    Module._saudio_context = null;
-    Module._saudio_node = null;
+/* setup a WebAudio context for a stream and attach a ScriptProcessorNode */
+EM_JS(int, saudio_js_init, (int slot_index, int sample_rate, int num_channels, int buffer_size, int s16), {
+    if (!Module._saudio_streams) {
+        Module._saudio_streams = {};
+    }
+    var context = null;
     if (typeof AudioContext !== 'undefined') {
-        Module._saudio_context = new AudioContext({
+        context = new AudioContext({
             sampleRate: sample_rate,
             latencyHint: 'interactive',
         });
     }
     else if (typeof webkitAudioContext !== 'undefined') {
-        Module._saudio_context = new webkitAudioContext({
+        context = new webkitAudioContext({
             sampleRate: sample_rate,
             latencyHint: 'interactive',
         });
     }
     else {
-        Module._saudio_context = null;
         console.log('sokol_audio.h: no WebAudio support');
     }
-    if (Module._saudio_context) {
-        console.log('sokol_audio.h: sample rate ', Module._saudio_context.sampleRate);
-        Module._saudio_node = Module._saudio_context.createScriptProcessor(buffer_size, 0, num_channels);
-        Module._saudio_node.onaudioprocess = function pump_audio(event) {
+    if (context) {
+        console.log('sokol_audio.h: sample rate ', context.sampleRate);
+        var node = context.createScriptProcessor(buffer_size, 0, num_channels);
+        node.onaudioprocess = function pump_audio(event) {
             var num_frames = event.outputBuffer.length;
-            var ptr = __saudio_emsc_pull(num_frames);
+            var ptr = __saudio_emsc_pull(slot_index, num_frames);
             if (ptr) {
                 var num_channels = event.outputBuffer.numberOfChannels;
                 for (var chn = 0; chn < num_channels; chn++) {
                     var chan = event.outputBuffer.getChannelData(chn);
-                    for (var i = 0; i < num_frames; i++) {
-                        chan[i] = HEAPF32[(ptr>>2) + ((num_channels*i)+chn)]
+                    if (s16) {
+                        for (var i = 0; i < num_frames; i++) {
+                            chan[i] = HEAP16[(ptr>>1) + ((num_channels*i)+chn)] / 32767.0;
+                        }
+                    }
+                    else {
+                        for (var i = 0; i < num_frames; i++) {
+                            chan[i] = HEAPF32[(ptr>>2) + ((num_channels*i)+chn)]
+                        }
                     }
                 }
             }
         };
-        Module._saudio_node.connect(Module._saudio_context.destination);
+        node.connect(context.destination);
+        Module._saudio_streams[slot_index] = { context: context, node: node };
 
         // in some browsers, WebAudio needs to be activated on a user action
         var resume_webaudio = function() {
-            if (Module._saudio_context) {
-                if (Module._saudio_context.state === 'suspended') {
-                    Module._saudio_context.resume();
-                }
+            if (context.state === 'suspended') {
+                context.resume();
             }
         };
         document.addEventListener('click', resume_webaudio, {once:true});
@@ -1608,22 +2020,25 @@ EM_JS(int, saudio_js_init, (int sample_rate, int num_channels, int buffer_size),
     }
 });
 
-/* shutdown the WebAudioContext and ScriptProcessorNode */
-EM_JS(void, saudio_js_shutdown, (void), {
-    if (Module._saudio_context !== null) {
-        if (Module._saudio_node) {
-            Module._saudio_node.disconnect();
+/* shutdown the WebAudioContext and ScriptProcessorNode of a stream */
+EM_JS(void, saudio_js_shutdown, (int slot_index), {
+    var strm = Module._saudio_streams ? Module._saudio_streams[slot_index] : null;
+    if (strm) {
+        if (strm.node) {
+            strm.node.disconnect();
+        }
+        if (strm.context.state !== 'closed') {
+            strm.context.close();
         }
-        Module._saudio_context.close();
-        Module._saudio_context = null;
-        Module._saudio_node = null;
+        delete Module._saudio_streams[slot_index];
     }
 });
 
 /* get the actual sample rate back from the WebAudio context */
-EM_JS(int, saudio_js_sample_rate, (void), {
-    if (Module._saudio_context) {
-        return Module._saudio_context.sampleRate;
+EM_JS(int, saudio_js_sample_rate, (int slot_index), {
+    var strm = Module._saudio_streams ? Module._saudio_streams[slot_index] : null;
+    if (strm) {
+        return strm.context.sampleRate;
     }
     else {
         return 0;
@@ -1631,22 +2046,29 @@ EM_JS(int, saudio_js_sample_rate, (void), {
 });
 
 /* get the actual buffer size in number of frames */
-EM_JS(int, saudio_js_buffer_frames, (void), {
-    if (Module._saudio_node) {
-        return Module._saudio_node.bufferSize;
+EM_JS(int, saudio_js_buffer_frames, (int slot_index), {
+    var strm = Module._saudio_streams ? Module._saudio_streams[slot_index] : null;
+    if (strm) {
+        return strm.node.bufferSize;
     }
     else {
         return 0;
     }
 });
 
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
-    if (saudio_js_init(_saudio.sample_rate, _saudio.num_channels, _saudio.buffer_frames)) {
-        _saudio.bytes_per_frame = (int)sizeof(float) * _saudio.num_channels;
-        _saudio.sample_rate = saudio_js_sample_rate();
-        _saudio.buffer_frames = saudio_js_buffer_frames();
-        const size_t buf_size = (size_t) (_saudio.buffer_frames * _saudio.bytes_per_frame);
-        _saudio.backend.buffer = (uint8_t*) SOKOL_MALLOC(buf_size);
+_SOKOL_PRIVATE int _saudio_emsc_slot_index(_saudio_stream_t* stream) {
+    return (int)(stream - _saudio.streams);
+}
+
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
+    const int slot_index = _saudio_emsc_slot_index(stream);
+    const int s16 = (stream->sample_format == SAUDIO_FORMAT_S16) ? 1 : 0;
+    if (saudio_js_init(slot_index, stream->sample_rate, stream->num_channels, stream->buffer_frames, s16)) {
+        stream->bytes_per_frame = _saudio_bytes_per_sample(stream->sample_format) * stream->num_channels;
+        stream->sample_rate = saudio_js_sample_rate(slot_index);
+        stream->buffer_frames = saudio_js_buffer_frames(slot_index);
+        const size_t buf_size = (size_t) (stream->buffer_frames * stream->bytes_per_frame);
+        stream->backend.buffer = (uint8_t*) SOKOL_MALLOC(buf_size);
         return true;
     }
     else {
@@ -1654,11 +2076,11 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
     }
 }
 
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
-    saudio_js_shutdown();
-    if (_saudio.backend.buffer) {
-        SOKOL_FREE(_saudio.backend.buffer);
-        _saudio.backend.buffer = 0;
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) {
+    saudio_js_shutdown(_saudio_emsc_slot_index(stream));
+    if (stream->backend.buffer) {
+        SOKOL_FREE(stream->backend.buffer);
+        stream->backend.buffer = 0;
     }
 }
 
@@ -1721,105 +2143,75 @@ _SOKOL_PRIVATE bool _saudio_semaphore_wait(_saudio_semaphore_t* sem)
     return ok;
 }
 
-/* fill intermediate buffer with new data and reset buffer_pos */
-_SOKOL_PRIVATE void _saudio_opensles_fill_buffer(void) {
-    int src_buffer_frames = _saudio.buffer_frames;
-    if (_saudio_has_callback()) {
-        _saudio_stream_callback(_saudio.backend.src_buffer, src_buffer_frames, _saudio.num_channels);
+/* fill the next output buffer with new data, converting from float if needed */
+_SOKOL_PRIVATE void _saudio_opensles_fill_buffer(_saudio_stream_t* stream, int16_t* dst) {
+    if (stream->sample_format == SAUDIO_FORMAT_S16) {
+        _saudio_fill_buffer(stream, dst, stream->buffer_frames);
     }
     else {
-        const int src_buffer_byte_size = src_buffer_frames * _saudio.num_channels * (int)sizeof(float);
-        if (0 == _saudio_fifo_read(&_saudio.fifo, (uint8_t*)_saudio.backend.src_buffer, src_buffer_byte_size)) {
-            /* not enough read data available, fill the entire buffer with silence */
-            memset(_saudio.backend.src_buffer, 0x0, (size_t)src_buffer_byte_size);
-        }
+        _saudio_fill_buffer(stream, stream->backend.src_buffer, stream->buffer_frames);
+        _saudio_f32_to_s16(dst, stream->backend.src_buffer, stream->buffer_frames * stream->num_channels);
     }
 }
 
 _SOKOL_PRIVATE void SLAPIENTRY _saudio_opensles_play_cb(SLPlayItf player, void *context, SLuint32 event) {
-    (void)(context);
+    _saudio_stream_t* stream = (_saudio_stream_t*) context;
     (void)(player);
 
     if (event & SL_PLAYEVENT_HEADATEND) {
-        _saudio_semaphore_post(&_saudio.backend.buffer_sem, 1);
+        _saudio_semaphore_post(&stream->backend.buffer_sem, 1);
     }
 }
 
 _SOKOL_PRIVATE void* _saudio_opensles_thread_fn(void* param) {
-    while (!_saudio.backend.thread_stop)  {
+    _saudio_stream_t* stream = (_saudio_stream_t*) param;
+    while (!stream->backend.thread_stop)  {
         /* get next output buffer, advance, next buffer. */
-        int16_t* out_buffer = _saudio.backend.output_buffers[_saudio.backend.active_buffer];
-        _saudio.backend.active_buffer = (_saudio.backend.active_buffer + 1) % SAUDIO_NUM_BUFFERS;
-        int16_t* next_buffer = _saudio.backend.output_buffers[_saudio.backend.active_buffer];
+        int16_t* out_buffer = stream->backend.output_buffers[stream->backend.active_buffer];
+        stream->backend.active_buffer = (stream->backend.active_buffer + 1) % SAUDIO_NUM_BUFFERS;
+        int16_t* next_buffer = stream->backend.output_buffers[stream->backend.active_buffer];
 
         /* queue this buffer */
-        const int buffer_size_bytes = _saudio.buffer_frames * _saudio.num_channels * (int)sizeof(short);
-        (*_saudio.backend.player_buffer_queue)->Enqueue(_saudio.backend.player_buffer_queue, out_buffer, (SLuint32)buffer_size_bytes);
+        const int buffer_size_bytes = stream->buffer_frames * stream->num_channels * (int)sizeof(short);
+        (*stream->backend.player_buffer_queue)->Enqueue(stream->backend.player_buffer_queue, out_buffer, (SLuint32)buffer_size_bytes);
 
         /* fill the next buffer */
-        _saudio_opensles_fill_buffer();
-        const int num_samples = _saudio.num_channels * _saudio.buffer_frames;
-        for (int i = 0; i < num_samples; ++i) {
-            next_buffer[i] = (int16_t) (_saudio.backend.src_buffer[i] * 0x7FFF);
-        }
+        _saudio_opensles_fill_buffer(stream, next_buffer);
 
-        _saudio_semaphore_wait(&_saudio.backend.buffer_sem);
+        _saudio_semaphore_wait(&stream->backend.buffer_sem);
     }
 
     return 0;
 }
 
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) {
-    _saudio.backend.thread_stop = 1;
-    pthread_join(_saudio.backend.thread, 0);
-
-    if (_saudio.backend.player_obj) {
-        (*_saudio.backend.player_obj)->Destroy(_saudio.backend.player_obj);
-    }
-
+/* the engine and output mix are created with the first, and destroyed with the last stream */
+_SOKOL_PRIVATE void _saudio_opensles_shared_shutdown(void) {
     if (_saudio.backend.output_mix_obj) {
         (*_saudio.backend.output_mix_obj)->Destroy(_saudio.backend.output_mix_obj);
+        _saudio.backend.output_mix_obj = 0;
     }
 
     if (_saudio.backend.engine_obj) {
         (*_saudio.backend.engine_obj)->Destroy(_saudio.backend.engine_obj);
+        _saudio.backend.engine_obj = 0;
     }
-
-    for (int i = 0; i < SAUDIO_NUM_BUFFERS; i++) {
-        SOKOL_FREE(_saudio.backend.output_buffers[i]);
-    }
-    SOKOL_FREE(_saudio.backend.src_buffer);
 }
 
-_SOKOL_PRIVATE bool _saudio_backend_init(void) {
-    _saudio.bytes_per_frame = (int)sizeof(float) * _saudio.num_channels;
-
-    for (int i = 0; i < SAUDIO_NUM_BUFFERS; ++i) {
-        const int buffer_size_bytes = (int)sizeof(int16_t) * _saudio.num_channels * _saudio.buffer_frames;
-        _saudio.backend.output_buffers[i] = (int16_t*) SOKOL_MALLOC((size_t)buffer_size_bytes);
-        SOKOL_ASSERT(_saudio.backend.output_buffers[i]);
-        memset(_saudio.backend.output_buffers[i], 0x0, (size_t)buffer_size_bytes);
-    }
-
-    {
-        const int buffer_size_bytes = _saudio.bytes_per_frame * _saudio.buffer_frames;
-        _saudio.backend.src_buffer = (float*) SOKOL_MALLOC((size_t)buffer_size_bytes);
-        SOKOL_ASSERT(_saudio.backend.src_buffer);
-        memset(_saudio.backend.src_buffer, 0x0, (size_t)buffer_size_bytes);
+_SOKOL_PRIVATE bool _saudio_opensles_shared_init(void) {
+    if (_saudio.backend.engine_obj) {
+        return true;
     }
 
     /* Create engine */
     const SLEngineOption opts[] = { SL_ENGINEOPTION_THREADSAFE, SL_BOOLEAN_TRUE };
     if (slCreateEngine(&_saudio.backend.engine_obj, 1, opts, 0, NULL, NULL ) != SL_RESULT_SUCCESS) {
         SOKOL_LOG("sokol_audio opensles: slCreateEngine failed");
-        _saudio_backend_shutdown();
         return false;
     }
 
     (*_saudio.backend.engine_obj)->Realize(_saudio.backend.engine_obj, SL_BOOLEAN_FALSE);
     if ((*_saudio.backend.engine_obj)->GetInterface(_saudio.backend.engine_obj, SL_IID_ENGINE, &_saudio.backend.engine) != SL_RESULT_SUCCESS) {
         SOKOL_LOG("sokol_audio opensles: GetInterface->Engine failed");
-        _saudio_backend_shutdown();
         return false;
     }
 
@@ -1831,7 +2223,6 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
         if( (*_saudio.backend.engine)->CreateOutputMix(_saudio.backend.engine, &_saudio.backend.output_mix_obj, 1, ids, req) != SL_RESULT_SUCCESS)
         {
             SOKOL_LOG("sokol_audio opensles: CreateOutputMix failed");
-            _saudio_backend_shutdown();
             return false;
         }
         (*_saudio.backend.output_mix_obj)->Realize(_saudio.backend.output_mix_obj, SL_BOOLEAN_FALSE);
@@ -1840,66 +2231,114 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
             SOKOL_LOG("sokol_audio opensles: GetInterface->OutputMixVol failed");
         }
     }
+    return true;
+}
+
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) {
+    if (stream->backend.thread) {
+        stream->backend.thread_stop = 1;
+        pthread_join(stream->backend.thread, 0);
+    }
+
+    if (stream->backend.player_obj) {
+        (*stream->backend.player_obj)->Destroy(stream->backend.player_obj);
+    }
+
+    if (0 == _saudio.num_streams) {
+        _saudio_opensles_shared_shutdown();
+    }
+
+    for (int i = 0; i < SAUDIO_NUM_BUFFERS; i++) {
+        SOKOL_FREE(stream->backend.output_buffers[i]);
+    }
+    if (stream->backend.src_buffer) {
+        SOKOL_FREE(stream->backend.src_buffer);
+    }
+}
+
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) {
+    stream->bytes_per_frame = _saudio_bytes_per_sample(stream->sample_format) * stream->num_channels;
+
+    for (int i = 0; i < SAUDIO_NUM_BUFFERS; ++i) {
+        const int buffer_size_bytes = (int)sizeof(int16_t) * stream->num_channels * stream->buffer_frames;
+        stream->backend.output_buffers[i] = (int16_t*) SOKOL_MALLOC((size_t)buffer_size_bytes);
+        SOKOL_ASSERT(stream->backend.output_buffers[i]);
+        memset(stream->backend.output_buffers[i], 0x0, (size_t)buffer_size_bytes);
+    }
+
+    if (stream->sample_format == SAUDIO_FORMAT_FLOAT) {
+        const int buffer_size_bytes = stream->bytes_per_frame * stream->buffer_frames;
+        stream->backend.src_buffer = (float*) SOKOL_MALLOC((size_t)buffer_size_bytes);
+        SOKOL_ASSERT(stream->backend.src_buffer);
+        memset(stream->backend.src_buffer, 0x0, (size_t)buffer_size_bytes);
+    }
+
+    /* create the shared engine and output mix */
+    if (!_saudio_opensles_shared_init()) {
+        _saudio_backend_shutdown(stream);
+        return false;
+    }
 
     /* android buffer queue */
-    _saudio.backend.in_locator.locatorType = SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE;
-    _saudio.backend.in_locator.numBuffers = SAUDIO_NUM_BUFFERS;
+    stream->backend.in_locator.locatorType = SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE;
+    stream->backend.in_locator.numBuffers = SAUDIO_NUM_BUFFERS;
 
     /* data format */
     SLDataFormat_PCM format;
     format.formatType = SL_DATAFORMAT_PCM;
-    format.numChannels = (SLuint32)_saudio.num_channels;
-    format.samplesPerSec = (SLuint32) (_saudio.sample_rate * 1000);
+    format.numChannels = (SLuint32)stream->num_channels;
+    format.samplesPerSec = (SLuint32) (stream->sample_rate * 1000);
     format.bitsPerSample = SL_PCMSAMPLEFORMAT_FIXED_16;
     format.containerSize = 16;
     format.endianness = SL_BYTEORDER_LITTLEENDIAN;
 
-    if (_saudio.num_channels == 2) {
+    if (stream->num_channels == 2) {
         format.channelMask = SL_SPEAKER_FRONT_LEFT | SL_SPEAKER_FRONT_RIGHT;
     } else {
         format.channelMask = SL_SPEAKER_FRONT_CENTER;
     }
 
     SLDataSource src;
-    src.pLocator = &_saudio.backend.in_locator;
+    src.pLocator = &stream->backend.in_locator;
     src.pFormat = &format;
 
     /* Output mix. */
-    _saudio.backend.out_locator.locatorType = SL_DATALOCATOR_OUTPUTMIX;
-    _saudio.backend.out_locator.outputMix = _saudio.backend.output_mix_obj;
+    stream->backend.out_locator.locatorType = SL_DATALOCATOR_OUTPUTMIX;
+    stream->backend.out_locator.outputMix = _saudio.backend.output_mix_obj;
 
-    _saudio.backend.dst_data_sink.pLocator = &_saudio.backend.out_locator;
-    _saudio.backend.dst_data_sink.pFormat = NULL;
+    stream->backend.dst_data_sink.pLocator = &stream->backend.out_locator;
+    stream->backend.dst_data_sink.pFormat = NULL;
 
     /* setup player */
     {
         const SLInterfaceID ids[] = { SL_IID_VOLUME, SL_IID_ANDROIDSIMPLEBUFFERQUEUE };
         const SLboolean req[] = { SL_BOOLEAN_FALSE, SL_BOOLEAN_TRUE };
 
-        (*_saudio.backend.engine)->CreateAudioPlayer(_saudio.backend.engine, &_saudio.backend.player_obj, &src, &_saudio.backend.dst_data_sink, sizeof(ids) / sizeof(ids[0]), ids, req);
+        (*_saudio.backend.engine)->CreateAudioPlayer(_saudio.backend.engine, &stream->backend.player_obj, &src, &stream->backend.dst_data_sink, sizeof(ids) / sizeof(ids[0]), ids, req);
 
-        (*_saudio.backend.player_obj)->Realize(_saudio.backend.player_obj, SL_BOOLEAN_FALSE);
+        (*stream->backend.player_obj)->Realize(stream->backend.player_obj, SL_BOOLEAN_FALSE);
 
-        (*_saudio.backend.player_obj)->GetInterface(_saudio.backend.player_obj, SL_IID_PLAY, &_saudio.backend.player);
-        (*_saudio.backend.player_obj)->GetInterface(_saudio.backend.player_obj, SL_IID_VOLUME, &_saudio.backend.player_vol);
+        (*stream->backend.player_obj)->GetInterface(stream->backend.player_obj, SL_IID_PLAY, &stream->backend.player);
+        (*stream->backend.player_obj)->GetInterface(stream->backend.player_obj, SL_IID_VOLUME, &stream->backend.player_vol);
 
-        (*_saudio.backend.player_obj)->GetInterface(_saudio.backend.player_obj, SL_IID_ANDROIDSIMPLEBUFFERQUEUE, &_saudio.backend.player_buffer_queue);
+        (*stream->backend.player_obj)->GetInterface(stream->backend.player_obj, SL_IID_ANDROIDSIMPLEBUFFERQUEUE, &stream->backend.player_buffer_queue);
     }
 
     /* begin */
     {
-        const int buffer_size_bytes = (int)sizeof(int16_t) * _saudio.num_channels * _saudio.buffer_frames;
-        (*_saudio.backend.player_buffer_queue)->Enqueue(_saudio.backend.player_buffer_queue, _saudio.backend.output_buffers[0], (SLuint32)buffer_size_bytes);
-        _saudio.backend.active_buffer = (_saudio.backend.active_buffer + 1) % SAUDIO_NUM_BUFFERS;
+        const int buffer_size_bytes = (int)sizeof(int16_t) * stream->num_channels * stream->buffer_frames;
+        (*stream->backend.player_buffer_queue)->Enqueue(stream->backend.player_buffer_queue, stream->backend.output_buffers[0], (SLuint32)buffer_size_bytes);
+        stream->backend.active_buffer = (stream->backend.active_buffer + 1) % SAUDIO_NUM_BUFFERS;
 
-        (*_saudio.backend.player)->RegisterCallback(_saudio.backend.player, _saudio_opensles_play_cb, NULL);
-        (*_saudio.backend.player)->SetCallbackEventsMask(_saudio.backend.player, SL_PLAYEVENT_HEADATEND);
-        (*_saudio.backend.player)->SetPlayState(_saudio.backend.player, SL_PLAYSTATE_PLAYING);
+        (*stream->backend.player)->RegisterCallback(stream->backend.player, _saudio_opensles_play_cb, stream);
+        (*stream->backend.player)->SetCallbackEventsMask(stream->backend.player, SL_PLAYEVENT_HEADATEND);
+        (*stream->backend.player)->SetPlayState(stream->backend.player, SL_PLAYSTATE_PLAYING);
     }
 
     /* create the buffer-streaming start thread */
-    if (0 != pthread_create(&_saudio.backend.thread, 0, _saudio_opensles_thread_fn, 0)) {
-        _saudio_backend_shutdown();
+    if (0 != pthread_create(&stream->backend.thread, 0, _saudio_opensles_thread_fn, stream)) {
+        stream->backend.thread = 0;
+        _saudio_backend_shutdown(stream);
         return false;
     }
 
@@ -1911,95 +2350,419 @@ _SOKOL_PRIVATE bool _saudio_backend_init(void) {
 #endif
 
 #else /* dummy backend */
-_SOKOL_PRIVATE bool _saudio_backend_init(void) { return false; };
-_SOKOL_PRIVATE void _saudio_backend_shutdown(void) { };
+_SOKOL_PRIVATE bool _saudio_backend_init(_saudio_stream_t* stream) { (void)stream; return false; };
+_SOKOL_PRIVATE void _saudio_backend_shutdown(_saudio_stream_t* stream) { (void)stream; };
 #endif
 
-/*=== PUBLIC API FUNCTIONS ===================================================*/
-SOKOL_API_IMPL void saudio_setup(const saudio_desc* desc) {
-    SOKOL_ASSERT(!_saudio.valid);
-    SOKOL_ASSERT(desc);
-    memset(&_saudio, 0, sizeof(_saudio));
-    _saudio.desc = *desc;
-    _saudio.stream_cb = desc->stream_cb;
-    _saudio.stream_userdata_cb = desc->stream_userdata_cb;
-    _saudio.user_data = desc->user_data;
-    _saudio.sample_rate = _saudio_def(_saudio.desc.sample_rate, _SAUDIO_DEFAULT_SAMPLE_RATE);
-    _saudio.buffer_frames = _saudio_def(_saudio.desc.buffer_frames, _SAUDIO_DEFAULT_BUFFER_FRAMES);
-    _saudio.packet_frames = _saudio_def(_saudio.desc.packet_frames, _SAUDIO_DEFAULT_PACKET_FRAMES);
-    _saudio.num_packets = _saudio_def(_saudio.desc.num_packets, _SAUDIO_DEFAULT_NUM_PACKETS);
-    _saudio.num_channels = _saudio_def(_saudio.desc.num_channels, 1);
-    _saudio_fifo_init_mutex(&_saudio.fifo);
-    if (_saudio_backend_init()) {
+/*=== STREAM MANAGEMENT ======================================================*/
+_SOKOL_PRIVATE int _saudio_slot_index(uint32_t id) {
+    return (int)(id & _SAUDIO_SLOT_MASK);
+}
+
+/* lookup a stream by public handle, return null if the handle is invalid or outdated */
+_SOKOL_PRIVATE _saudio_stream_t* _saudio_lookup_stream(uint32_t id) {
+    if (_saudio.valid && (0 != id)) {
+        const int slot_index = _saudio_slot_index(id);
+        if (slot_index < SAUDIO_MAX_STREAMS) {
+            _saudio_stream_t* stream = &_saudio.streams[slot_index];
+            if ((stream->id == id) && stream->valid) {
+                return stream;
+            }
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE void _saudio_free_cvt_buffer(_saudio_stream_t* stream) {
+    if (stream->cvt_buffer) {
+        SOKOL_FREE(stream->cvt_buffer);
+        stream->cvt_buffer = 0;
+    }
+}
+
+/* offline streams skip the backend, and render into a buffer of their own */
+_SOKOL_PRIVATE bool _saudio_offline_init(_saudio_stream_t* stream) {
+    stream->bytes_per_frame = stream->num_channels * _saudio_bytes_per_sample(stream->sample_format);
+    stream->offline_buffer = (uint8_t*) SOKOL_MALLOC((size_t)(stream->buffer_frames * stream->bytes_per_frame));
+    SOKOL_ASSERT(stream->offline_buffer);
+    return true;
+}
+
+_SOKOL_PRIVATE void _saudio_offline_shutdown(_saudio_stream_t* stream) {
+    if (stream->offline_buffer) {
+        SOKOL_FREE(stream->offline_buffer);
+        stream->offline_buffer = 0;
+    }
+}
+
+_SOKOL_PRIVATE bool _saudio_stream_backend_init(_saudio_stream_t* stream) {
+    return stream->offline ? _saudio_offline_init(stream) : _saudio_backend_init(stream);
+}
+
+_SOKOL_PRIVATE void _saudio_stream_backend_shutdown(_saudio_stream_t* stream) {
+    if (stream->offline) {
+        _saudio_offline_shutdown(stream);
+    }
+    else {
+        _saudio_backend_shutdown(stream);
+    }
+}
+
+_SOKOL_PRIVATE bool _saudio_init_stream(_saudio_stream_t* stream, const saudio_desc* desc) {
+    SOKOL_ASSERT(stream && desc);
+    SOKOL_ASSERT(!stream->valid);
+    memset(stream, 0, sizeof(_saudio_stream_t));
+    stream->desc = *desc;
+    stream->stream_cb = desc->stream_cb;
+    stream->stream_userdata_cb = desc->stream_userdata_cb;
+    stream->user_data = desc->user_data;
+    stream->sample_rate = _saudio_def(stream->desc.sample_rate, _SAUDIO_DEFAULT_SAMPLE_RATE);
+    stream->buffer_frames = _saudio_def(stream->desc.buffer_frames, _SAUDIO_DEFAULT_BUFFER_FRAMES);
+    stream->packet_frames = _saudio_def(stream->desc.packet_frames, _SAUDIO_DEFAULT_PACKET_FRAMES);
+    stream->num_packets = _saudio_def(stream->desc.num_packets, _SAUDIO_DEFAULT_NUM_PACKETS);
+    stream->num_channels = _saudio_def(stream->desc.num_channels, 1);
+    stream->sample_format = _saudio_def(stream->desc.format, SAUDIO_FORMAT_FLOAT);
+    stream->offline = desc->offline;
+    SOKOL_ASSERT((stream->sample_format > _SAUDIO_FORMAT_DEFAULT) && (stream->sample_format < _SAUDIO_FORMAT_NUM));
+    if (stream->sample_format != SAUDIO_FORMAT_FLOAT) {
+        /* intermediate float buffer for the stream callback */
+        stream->cvt_buffer_frames = stream->buffer_frames;
+        stream->cvt_buffer = (float*) SOKOL_MALLOC((size_t)(stream->cvt_buffer_frames * stream->num_channels) * sizeof(float));
+        SOKOL_ASSERT(stream->cvt_buffer);
+    }
+    _saudio_fifo_init_mutex(&stream->fifo);
+    if (_saudio_stream_backend_init(stream)) {
         /* the backend might not support the requested exact buffer size,
            make sure the actual buffer size is still a multiple of
            the requested packet size
         */
-        if (0 != (_saudio.buffer_frames % _saudio.packet_frames)) {
+        if (0 != (stream->buffer_frames % stream->packet_frames)) {
             SOKOL_LOG("sokol_audio.h: actual backend buffer size isn't multiple of requested packet size");
-            _saudio_backend_shutdown();
-            return;
+            _saudio_stream_backend_shutdown(stream);
+        }
+        else {
+            SOKOL_ASSERT(stream->bytes_per_frame > 0);
+            _saudio_fifo_init(&stream->fifo, stream->packet_frames * stream->bytes_per_frame, stream->num_packets);
+            stream->valid = true;
+            return true;
+        }
+    }
+    _saudio_mutex_destroy(&stream->fifo.mutex);
+    _saudio_free_cvt_buffer(stream);
+    return false;
+}
+
+_SOKOL_PRIVATE void _saudio_discard_stream(_saudio_stream_t* stream) {
+    SOKOL_ASSERT(stream && stream->valid);
+    _saudio_stream_backend_shutdown(stream);
+    _saudio_fifo_shutdown(&stream->fifo);
+    _saudio_free_cvt_buffer(stream);
+    stream->valid = false;
+    stream->id = 0;
+}
+
+_SOKOL_PRIVATE saudio_stream _saudio_make_stream(const saudio_desc* desc) {
+    saudio_stream res = { 0 };
+    for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+        _saudio_stream_t* stream = &_saudio.streams[i];
+        if (0 == stream->id) {
+            if (_saudio_init_stream(stream, desc)) {
+                _saudio.unique_counter = (_saudio.unique_counter + 1) & ((1<<(32-_SAUDIO_SLOT_SHIFT))-1);
+                if (0 == _saudio.unique_counter) {
+                    _saudio.unique_counter = 1;
+                }
+                stream->id = (_saudio.unique_counter << _SAUDIO_SLOT_SHIFT) | (uint32_t)i;
+                if (!stream->offline) {
+                    _saudio.num_streams++;
+                }
+                res.id = stream->id;
+            }
+            return res;
+        }
+    }
+    SOKOL_LOG("sokol_audio.h: no free stream slots (see SAUDIO_MAX_STREAMS)");
+    return res;
+}
+
+_SOKOL_PRIVATE void _saudio_destroy_stream(_saudio_stream_t* stream) {
+    /* backends check num_streams to decide when to release shared resources */
+    if (!stream->offline) {
+        SOKOL_ASSERT(_saudio.num_streams > 0);
+        _saudio.num_streams--;
+    }
+    _saudio_discard_stream(stream);
+}
+
+_SOKOL_PRIVATE int _saudio_stream_expect(_saudio_stream_t* stream) {
+    if (stream) {
+        const int num_frames = _saudio_fifo_writable_bytes(&stream->fifo) / stream->bytes_per_frame;
+        return num_frames;
+    }
+    else {
+        return 0;
+    }
+}
+
+_SOKOL_PRIVATE int _saudio_stream_push(_saudio_stream_t* stream, const float* frames, int num_frames) {
+    SOKOL_ASSERT(frames && (num_frames > 0));
+    if (stream) {
+        if (stream->sample_format == SAUDIO_FORMAT_FLOAT) {
+            const int num_bytes = num_frames * stream->bytes_per_frame;
+            const int num_written = _saudio_fifo_write(&stream->fifo, (const uint8_t*)frames, num_bytes);
+            return num_written / stream->bytes_per_frame;
+        }
+        else {
+            return _saudio_push_converted(stream, frames, SAUDIO_FORMAT_FLOAT, num_frames);
+        }
+    }
+    else {
+        return 0;
+    }
+}
+
+_SOKOL_PRIVATE int _saudio_stream_push_s16(_saudio_stream_t* stream, const int16_t* frames, int num_frames) {
+    SOKOL_ASSERT(frames && (num_frames > 0));
+    if (stream) {
+        if (stream->sample_format == SAUDIO_FORMAT_S16) {
+            const int num_bytes = num_frames * stream->bytes_per_frame;
+            const int num_written = _saudio_fifo_write(&stream->fifo, (const uint8_t*)frames, num_bytes);
+            return num_written / stream->bytes_per_frame;
+        }
+        else {
+            return _saudio_push_converted(stream, frames, SAUDIO_FORMAT_S16, num_frames);
         }
-        SOKOL_ASSERT(_saudio.bytes_per_frame > 0);
-        _saudio_fifo_init(&_saudio.fifo, _saudio.packet_frames * _saudio.bytes_per_frame, _saudio.num_packets);
-        _saudio.valid = true;
+    }
+    else {
+        return 0;
+    }
+}
+
+_SOKOL_PRIVATE void _saudio_offline_sink(_saudio_stream_t* stream, const void* buffer, int num_frames) {
+    if (stream->desc.offline_sink_cb) {
+        stream->desc.offline_sink_cb(buffer, num_frames, stream->num_channels);
+    }
+    else if (stream->desc.offline_sink_userdata_cb) {
+        stream->desc.offline_sink_userdata_cb(buffer, num_frames, stream->num_channels, stream->desc.user_data);
+    }
+}
+
+/* current time of a monotonic clock in seconds */
+_SOKOL_PRIVATE double _saudio_clock_now(void) {
+    #if defined(_WIN32)
+        LARGE_INTEGER freq, counter;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&counter);
+        return (double)counter.QuadPart / (double)freq.QuadPart;
+    #elif defined(__APPLE__)
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        return ((double)mach_absolute_time() * (double)timebase.numer / (double)timebase.denom) * 1.0e-9;
+    #elif defined(__EMSCRIPTEN__)
+        return emscripten_get_now() * 1.0e-3;
+    #elif defined(CLOCK_MONOTONIC)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9;
+    #else
+        /* strict ANSI mode hides clock_gettime(), fall back to CPU time */
+        return (double)clock() / (double)CLOCKS_PER_SEC;
+    #endif
+}
+
+_SOKOL_PRIVATE int _saudio_stream_render(_saudio_stream_t* stream, int num_frames) {
+    SOKOL_ASSERT(num_frames >= 0);
+    if (stream) {
+        SOKOL_ASSERT(stream->offline);
+        if (!stream->offline) {
+            /* realtime streams are consumed by the backend thread */
+            return 0;
+        }
+        /* the fifo can only be read in multiples of the packet size */
+        num_frames -= num_frames % stream->packet_frames;
+        /* pull the callback with a full buffer, like a backend would */
+        const int max_chunk_frames = _saudio_has_callback(stream) ? stream->buffer_frames : stream->packet_frames;
+        const double start = _saudio_clock_now();
+        int frames_left = num_frames;
+        while (frames_left > 0) {
+            const int chunk_frames = (frames_left < max_chunk_frames) ? frames_left : max_chunk_frames;
+            _saudio_fill_buffer(stream, stream->offline_buffer, chunk_frames);
+            _saudio_offline_sink(stream, stream->offline_buffer, chunk_frames);
+            frames_left -= chunk_frames;
+        }
+        stream->offline_secs += _saudio_clock_now() - start;
+        stream->offline_frames += (uint64_t)num_frames;
+        return num_frames;
+    }
+    else {
+        return 0;
+    }
+}
+
+_SOKOL_PRIVATE double _saudio_stream_realtime_factor(_saudio_stream_t* stream) {
+    if (stream && (stream->offline_secs > 0.0)) {
+        const double audio_secs = (double)stream->offline_frames / (double)stream->sample_rate;
+        return audio_secs / stream->offline_secs;
+    }
+    else {
+        return 0.0;
+    }
+}
+
+_SOKOL_PRIVATE _saudio_stream_t* _saudio_default_stream(void) {
+    return _saudio_lookup_stream(_saudio.default_stream.id);
+}
+
+/*=== PUBLIC API FUNCTIONS ===================================================*/
+SOKOL_API_IMPL void saudio_setup(const saudio_desc* desc) {
+    SOKOL_ASSERT(!_saudio.valid);
+    SOKOL_ASSERT(desc);
+    memset(&_saudio, 0, sizeof(_saudio));
+    _saudio.valid = true;
+    _saudio.default_stream = _saudio_make_stream(desc);
+    if (0 == _saudio.default_stream.id) {
+        /* like before multiple streams, a failed setup leaves sokol-audio invalid */
+        _saudio.valid = false;
     }
 }
 
 SOKOL_API_IMPL void saudio_shutdown(void) {
     if (_saudio.valid) {
-        _saudio_backend_shutdown();
-        _saudio_fifo_shutdown(&_saudio.fifo);
+        for (int i = 0; i < SAUDIO_MAX_STREAMS; i++) {
+            if (_saudio.streams[i].valid) {
+                _saudio_destroy_stream(&_saudio.streams[i]);
+            }
+        }
+        SOKOL_ASSERT(0 == _saudio.num_streams);
         _saudio.valid = false;
     }
 }
 
 SOKOL_API_IMPL bool saudio_isvalid(void) {
-    return _saudio.valid;
+    return 0 != _saudio_default_stream();
 }
 
 SOKOL_API_IMPL void* saudio_userdata(void) {
-    return _saudio.desc.user_data;
+    return saudio_stream_userdata(_saudio.default_stream);
 }
 
 SOKOL_API_IMPL saudio_desc saudio_query_desc(void) {
-    return _saudio.desc;
+    return saudio_stream_query_desc(_saudio.default_stream);
 }
 
 SOKOL_API_IMPL int saudio_sample_rate(void) {
-    return _saudio.sample_rate;
+    return saudio_stream_sample_rate(_saudio.default_stream);
 }
 
 SOKOL_API_IMPL int saudio_buffer_frames(void) {
-    return _saudio.buffer_frames;
+    return saudio_stream_buffer_frames(_saudio.default_stream);
 }
 
 SOKOL_API_IMPL int saudio_channels(void) {
-    return _saudio.num_channels;
+    return saudio_stream_channels(_saudio.default_stream);
 }
 
 SOKOL_API_IMPL int saudio_expect(void) {
-    if (_saudio.valid) {
-        const int num_frames = _saudio_fifo_writable_bytes(&_saudio.fifo) / _saudio.bytes_per_frame;
-        return num_frames;
-    }
-    else {
-        return 0;
-    }
+    return _saudio_stream_expect(_saudio_default_stream());
 }
 
 SOKOL_API_IMPL int saudio_push(const float* frames, int num_frames) {
-    SOKOL_ASSERT(frames && (num_frames > 0));
-    if (_saudio.valid) {
-        const int num_bytes = num_frames * _saudio.bytes_per_frame;
-        const int num_written = _saudio_fifo_write(&_saudio.fifo, (const uint8_t*)frames, num_bytes);
-        return num_written / _saudio.bytes_per_frame;
+    return _saudio_stream_push(_saudio_default_stream(), frames, num_frames);
+}
+
+SOKOL_API_IMPL int saudio_push_s16(const int16_t* frames, int num_frames) {
+    return _saudio_stream_push_s16(_saudio_default_stream(), frames, num_frames);
+}
+
+SOKOL_API_IMPL saudio_format saudio_sample_format(void) {
+    return saudio_stream_sample_format(_saudio.default_stream);
+}
+
+SOKOL_API_IMPL saudio_stream saudio_default_stream(void) {
+    return _saudio.default_stream;
+}
+
+SOKOL_API_IMPL saudio_stream saudio_make_stream(const saudio_desc* desc) {
+    SOKOL_ASSERT(_saudio.valid);
+    SOKOL_ASSERT(desc);
+    return _saudio_make_stream(desc);
+}
+
+SOKOL_API_IMPL void saudio_destroy_stream(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    if (strm) {
+        _saudio_destroy_stream(strm);
+    }
+}
+
+SOKOL_API_IMPL bool saudio_stream_isvalid(saudio_stream stream) {
+    return 0 != _saudio_lookup_stream(stream.id);
+}
+
+SOKOL_API_IMPL void* saudio_stream_userdata(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    return strm ? strm->desc.user_data : 0;
+}
+
+SOKOL_API_IMPL saudio_desc saudio_stream_query_desc(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    if (strm) {
+        return strm->desc;
     }
     else {
-        return 0;
+        saudio_desc desc;
+        memset(&desc, 0, sizeof(desc));
+        return desc;
     }
 }
 
+SOKOL_API_IMPL int saudio_stream_sample_rate(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    return strm ? strm->sample_rate : 0;
+}
+
+SOKOL_API_IMPL int saudio_stream_buffer_frames(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    return strm ? strm->buffer_frames : 0;
+}
+
+SOKOL_API_IMPL int saudio_stream_channels(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    return strm ? strm->num_channels : 0;
+}
+
+SOKOL_API_IMPL saudio_format saudio_stream_sample_format(saudio_stream stream) {
+    _saudio_stream_t* strm = _saudio_lookup_stream(stream.id);
+    return strm ? strm->sample_format : _SAUDIO_FORMAT_DEFAULT;
+}
+
+SOKOL_API_IMPL int saudio_stream_expect(saudio_stream stream) {
+    return _saudio_stream_expect(_saudio_lookup_stream(stream.id));
+}
+
+SOKOL_API_IMPL int saudio_stream_push(saudio_stream stream, const float* frames, int num_frames) {
+    return _saudio_stream_push(_saudio_lookup_stream(stream.id), frames, num_frames);
+}
+
+SOKOL_API_IMPL int saudio_stream_push_s16(saudio_stream stream, const int16_t* frames, int num_frames) {
+    return _saudio_stream_push_s16(_saudio_lookup_stream(stream.id), frames, num_frames);
+}
+
+SOKOL_API_IMPL int saudio_render(int num_frames) {
+    return _saudio_stream_render(_saudio_default_stream(), num_frames);
+}
+
+SOKOL_API_IMPL int saudio_stream_render(saudio_stream stream, int num_frames) {
+    return _saudio_stream_render(_saudio_lookup_stream(stream.id), num_frames);
+}
+
+SOKOL_API_IMPL double saudio_realtime_factor(void) {
+    return _saudio_stream_realtime_factor(_saudio_default_stream());
+}
+
+SOKOL_API_IMPL double saudio_stream_realtime_factor(saudio_stream stream) {
+    return _saudio_stream_realtime_factor(_saudio_lookup_stream(stream.id));
+}
+
 #undef _saudio_def
 #undef _saudio_def_flt
 
@@ -201,6 +201,35 @@
         operation only references the valid (updated) data in the
         buffer or image.
 
+    --- to update a rectangular region of one mip level and slice of an image
+        (for instance to add a new glyph to a font atlas), call:
+
+            sg_update_image_region(sg_image img, int mip_level, int slice,
+                int x, int y, int width, int height,
+                const sg_range* data, int row_pitch)
+
+        'slice' is the cubemap face for cubemaps, the array layer for array
+        textures, the depth slice for 3D textures and 0 for 2D textures.
+        'row_pitch' is the distance in bytes between the start of two rows
+        in the data, or 0 if the rows are tightly packed (this allows to
+        upload a sub-rectangle of a bigger CPU-side image without copying).
+
+        The image must have been created with SG_USAGE_DYNAMIC and
+        .region_updates = true, and must not use a compressed pixel
+        format (on D3D11, such images are D3D11_USAGE_DEFAULT textures which
+        are updated with UpdateSubresource(), other dynamic images remain
+        D3D11_USAGE_DYNAMIC textures). Unlike sg_update_image(), region
+        updates can be called any number of times per frame, and can be
+        mixed with sg_update_image() (which still replaces the entire
+        image content).
+
+        Region updates are written into the texture which is currently
+        used for rendering (the image isn't 'renamed' like in
+        sg_update_image()). This is fine for updating areas which haven't
+        been used in rendering yet (like adding new glyphs to a font atlas),
+        but note that on Metal, overwriting pixels which are still used by
+        frames in flight may affect the rendering of those frames.
+
     --- to append a chunk of data to a buffer resource, call:
 
             int sg_append_buffer(sg_buffer buf, const sg_range* data)
@@ -1604,6 +1633,7 @@ typedef struct sg_image_data {
     .num_slices         1 (3D textures: depth; array textures: number of layers)
     .num_mipmaps:       1
     .usage:             SG_USAGE_IMMUTABLE
+    .region_updates:    false (true if the image is updated with sg_update_image_region(), requires SG_USAGE_DYNAMIC)
     .pixel_format:      SG_PIXELFORMAT_RGBA8 for textures, or sg_desc.context.color_format for render targets
     .sample_count:      1 for textures, or sg_desc.context.sample_count for render targets
     .min_filter:        SG_FILTER_NEAREST
@@ -1668,6 +1698,7 @@ typedef struct sg_image_desc {
     int num_slices;
     int num_mipmaps;
     sg_usage usage;
+    bool region_updates;
     sg_pixel_format pixel_format;
     int sample_count;
     sg_filter min_filter;
@@ -1984,6 +2015,7 @@ typedef struct sg_trace_hooks {
     void (*destroy_pass)(sg_pass pass, void* user_data);
     void (*update_buffer)(sg_buffer buf, const sg_range* data, void* user_data);
     void (*update_image)(sg_image img, const sg_image_data* data, void* user_data);
+    void (*update_image_region)(sg_image img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch, void* user_data);
     void (*append_buffer)(sg_buffer buf, const sg_range* data, int result, void* user_data);
     void (*begin_default_pass)(const sg_pass_action* pass_action, int width, int height, void* user_data);
     void (*begin_pass)(sg_pass pass, const sg_pass_action* pass_action, void* user_data);
@@ -2284,6 +2316,7 @@ SOKOL_GFX_API_DECL void sg_destroy_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_destroy_pass(sg_pass pass);
 SOKOL_GFX_API_DECL void sg_update_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data);
+SOKOL_GFX_API_DECL void sg_update_image_region(sg_image img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch);
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL bool sg_query_buffer_overflow(sg_buffer buf);
 
@@ -2386,6 +2419,7 @@ inline sg_shader sg_make_shader(const sg_shader_desc& desc) { return sg_make_sha
 inline sg_pipeline sg_make_pipeline(const sg_pipeline_desc& desc) { return sg_make_pipeline(&desc); }
 inline sg_pass sg_make_pass(const sg_pass_desc& desc) { return sg_make_pass(&desc); }
 inline void sg_update_image(sg_image img, const sg_image_data& data) { return sg_update_image(img, &data); }
+inline void sg_update_image_region(sg_image img, int mip_level, int slice, int x, int y, int width, int height, const sg_range& data, int row_pitch) { return sg_update_image_region(img, mip_level, slice, x, y, width, height, &data, row_pitch); }
 
 inline void sg_begin_default_pass(const sg_pass_action& pass_action, int width, int height) { return sg_begin_default_pass(&pass_action, width, height); }
 inline void sg_begin_default_passf(const sg_pass_action& pass_action, float width, float height) { return sg_begin_default_passf(&pass_action, width, height); }
@@ -2741,6 +2775,7 @@ typedef struct {
     int num_slices;
     int num_mipmaps;
     sg_usage usage;
+    bool region_updates;
     sg_pixel_format pixel_format;
     int sample_count;
     sg_filter min_filter;
@@ -2763,6 +2798,7 @@ _SOKOL_PRIVATE void _sg_image_common_init(_sg_image_common_t* cmn, const sg_imag
     cmn->num_slices = desc->num_slices;
     cmn->num_mipmaps = desc->num_mipmaps;
     cmn->usage = desc->usage;
+    cmn->region_updates = desc->region_updates;
     cmn->pixel_format = desc->pixel_format;
     cmn->sample_count = desc->sample_count;
     cmn->min_filter = desc->min_filter;
@@ -3001,6 +3037,15 @@ typedef _sg_dummy_buffer_t _sg_buffer_t;
 typedef struct {
     _sg_slot_t slot;
     _sg_image_common_t cmn;
+    struct {
+        int num_region_updates;     /* number of sg_update_image_region() calls */
+        int region_mip_level;       /* the most recently updated region */
+        int region_slice;
+        int region_x;
+        int region_y;
+        int region_width;
+        int region_height;
+    } dummy;
 } _sg_dummy_image_t;
 typedef _sg_dummy_image_t _sg_image_t;
 
@@ -3662,6 +3707,7 @@ typedef enum {
     _SG_VALIDATE_IMAGEDESC_RT_NO_DATA,
     _SG_VALIDATE_IMAGEDESC_DATA,
     _SG_VALIDATE_IMAGEDESC_NO_DATA,
+    _SG_VALIDATE_IMAGEDESC_REGIONUPDATES_USAGE,
 
     /* shader creation */
     _SG_VALIDATE_SHADERDESC_CANARY,
@@ -3759,7 +3805,17 @@ typedef enum {
     _SG_VALIDATE_UPDIMG_NOTENOUGHDATA,
     _SG_VALIDATE_UPDIMG_SIZE,
     _SG_VALIDATE_UPDIMG_COMPRESSED,
-    _SG_VALIDATE_UPDIMG_ONCE
+    _SG_VALIDATE_UPDIMG_ONCE,
+
+    /* sg_update_image_region validation */
+    _SG_VALIDATE_UPDIMGREGION_USAGE,
+    _SG_VALIDATE_UPDIMGREGION_NOT_ENABLED,
+    _SG_VALIDATE_UPDIMGREGION_COMPRESSED,
+    _SG_VALIDATE_UPDIMGREGION_MIPLEVEL,
+    _SG_VALIDATE_UPDIMGREGION_SLICE,
+    _SG_VALIDATE_UPDIMGREGION_RECT,
+    _SG_VALIDATE_UPDIMGREGION_ROWPITCH,
+    _SG_VALIDATE_UPDIMGREGION_NOTENOUGHDATA
 } _sg_validate_error_t;
 
 /*=== GENERIC BACKEND STATE ==================================================*/
@@ -4390,6 +4446,20 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
+_SOKOL_PRIVATE void _sg_dummy_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(img && data);
+    _SOKOL_UNUSED(data);
+    _SOKOL_UNUSED(row_pitch);
+    /* record the updated region so that region updates can be tested without a 3D-API */
+    img->dummy.num_region_updates++;
+    img->dummy.region_mip_level = mip_level;
+    img->dummy.region_slice = slice;
+    img->dummy.region_x = x;
+    img->dummy.region_y = y;
+    img->dummy.region_width = width;
+    img->dummy.region_height = height;
+}
+
 /*== GL BACKEND ==============================================================*/
 #elif defined(_SOKOL_ANY_GL)
 
@@ -7049,6 +7119,65 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
     _sg_gl_cache_restore_texture_binding(0);
 }
 
+_SOKOL_PRIVATE void _sg_gl_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(img && data && data->ptr);
+    /* region updates don't rotate the renaming slot, the next sg_update_image()
+       overwrites the entire content of the next slot anyway
+    */
+    SOKOL_ASSERT(img->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
+    _sg_gl_cache_store_texture_binding(0);
+    _sg_gl_cache_bind_texture(0, img->gl.target, img->gl.tex[img->cmn.active_slot]);
+    const GLenum gl_img_format = _sg_gl_teximage_format(img->cmn.pixel_format);
+    const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
+    GLenum gl_img_target = img->gl.target;
+    if (SG_IMAGETYPE_CUBE == img->cmn.type) {
+        gl_img_target = _sg_gl_cubeface_target(slice);
+    }
+    /* rows are tightly packed unless a row pitch is given, GLES2 has no
+       GL_UNPACK_ROW_LENGTH, in that case upload row by row
+    */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    bool row_by_row = row_pitch != _sg_row_pitch(img->cmn.pixel_format, width, 1);
+    #if !defined(SOKOL_GLES2)
+    const bool use_row_length = row_by_row && !_sg.gl.gles2;
+    if (use_row_length) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, row_pitch / _sg_pixelformat_bytesize(img->cmn.pixel_format));
+        row_by_row = false;
+    }
+    #endif
+    const int num_uploads = row_by_row ? height : 1;
+    const int upload_height = row_by_row ? 1 : height;
+    const uint8_t* data_ptr = (const uint8_t*) data->ptr;
+    for (int i = 0; i < num_uploads; i++, data_ptr += row_pitch) {
+        if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
+            glTexSubImage2D(gl_img_target, mip_level,
+                x, y + i,
+                width, upload_height,
+                gl_img_format, gl_img_type,
+                data_ptr);
+        }
+        #if !defined(SOKOL_GLES2)
+        else if (!_sg.gl.gles2 && ((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type))) {
+            glTexSubImage3D(gl_img_target, mip_level,
+                x, y + i, slice,
+                width, upload_height, 1,
+                gl_img_format, gl_img_type,
+                data_ptr);
+        }
+        #endif
+    }
+    #if !defined(SOKOL_GLES2)
+    if (use_row_length) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+    #endif
+    /* restore the GL default */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    _sg_gl_cache_restore_texture_binding(0);
+    _SG_GL_CHECK_ERROR();
+}
+
 /*== D3D11 BACKEND IMPLEMENTATION ============================================*/
 #elif defined(SOKOL_D3D11)
 
@@ -7452,6 +7581,15 @@ _SOKOL_PRIVATE UINT _sg_d3d11_cpu_access_flags(sg_usage usg) {
     }
 }
 
+/* images with region updates are D3D11_USAGE_DEFAULT textures so that sg_update_image_region() can use UpdateSubresource() */
+_SOKOL_PRIVATE D3D11_USAGE _sg_d3d11_image_usage(const _sg_image_common_t* cmn) {
+    return cmn->region_updates ? D3D11_USAGE_DEFAULT : _sg_d3d11_usage(cmn->usage);
+}
+
+_SOKOL_PRIVATE UINT _sg_d3d11_image_cpu_access_flags(const _sg_image_common_t* cmn) {
+    return cmn->region_updates ? 0 : _sg_d3d11_cpu_access_flags(cmn->usage);
+}
+
 _SOKOL_PRIVATE DXGI_FORMAT _sg_d3d11_pixel_format(sg_pixel_format fmt) {
     switch (fmt) {
         case SG_PIXELFORMAT_R8:             return DXGI_FORMAT_R8_UNORM;
@@ -7962,8 +8100,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
                     d3d11_tex_desc.CPUAccessFlags = 0;
                 }
                 else {
-                    d3d11_tex_desc.Usage = _sg_d3d11_usage(img->cmn.usage);
-                    d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_cpu_access_flags(img->cmn.usage);
+                    d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&img->cmn);
+                    d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&img->cmn);
                 }
                 if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
                     /* trying to create a texture format that's not supported by D3D */
@@ -8039,8 +8177,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
                     d3d11_tex_desc.CPUAccessFlags = 0;
                 }
                 else {
-                    d3d11_tex_desc.Usage = _sg_d3d11_usage(img->cmn.usage);
-                    d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_cpu_access_flags(img->cmn.usage);
+                    d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&img->cmn);
+                    d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&img->cmn);
                 }
                 if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
                     /* trying to create a texture format that's not supported by D3D */
@@ -8882,6 +9020,12 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
                 const size_t slice_size = subimg_data->size / (size_t)num_slices;
                 const size_t slice_offset = slice_size * (size_t)slice_index;
                 const uint8_t* slice_ptr = ((const uint8_t*)subimg_data->ptr) + slice_offset;
+                if (img->cmn.region_updates) {
+                    /* D3D11_USAGE_DEFAULT texture, see _sg_d3d11_image_usage() */
+                    const int src_depth_pitch = _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1);
+                    _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, d3d11_res, subres_index, NULL, slice_ptr, (UINT)src_pitch, (UINT)src_depth_pitch);
+                    continue;
+                }
                 hr = _sg_d3d11_Map(_sg.d3d11.ctx, d3d11_res, subres_index, D3D11_MAP_WRITE_DISCARD, 0, &d3d11_msr);
                 SOKOL_ASSERT(SUCCEEDED(hr));
                 /* FIXME: need to handle difference in depth-pitch for 3D textures as well! */
@@ -8904,6 +9048,35 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
+_SOKOL_PRIVATE void _sg_d3d11_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(img && data && data->ptr);
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(img->d3d11.tex2d || img->d3d11.tex3d);
+    /* only images with region updates (which are D3D11_USAGE_DEFAULT textures) can be updated with UpdateSubresource() */
+    SOKOL_ASSERT(img->cmn.region_updates);
+    D3D11_BOX box;
+    box.left = (UINT)x;
+    box.top = (UINT)y;
+    box.right = (UINT)(x + width);
+    box.bottom = (UINT)(y + height);
+    ID3D11Resource* d3d11_res = 0;
+    UINT subres_index = 0;
+    if (img->d3d11.tex3d) {
+        d3d11_res = (ID3D11Resource*) img->d3d11.tex3d;
+        subres_index = (UINT)mip_level;
+        box.front = (UINT)slice;
+        box.back = (UINT)(slice + 1);
+    }
+    else {
+        /* cubemap faces are array slices in D3D11 */
+        d3d11_res = (ID3D11Resource*) img->d3d11.tex2d;
+        subres_index = _sg_d3d11_calcsubresource((UINT)mip_level, (UINT)slice, (UINT)img->cmn.num_mipmaps);
+        box.front = 0;
+        box.back = 1;
+    }
+    _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, d3d11_res, subres_index, &box, data->ptr, (UINT)row_pitch, (UINT)(row_pitch * height));
+}
+
 /*== METAL BACKEND IMPLEMENTATION ============================================*/
 #elif defined(SOKOL_METAL)
 
@@ -10581,6 +10754,29 @@ _SOKOL_PRIVATE void _sg_mtl_update_image(_sg_image_t* img, const sg_image_data*
     _sg_mtl_copy_image_data(img, mtl_tex, data);
 }
 
+_SOKOL_PRIVATE void _sg_mtl_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(img && data && data->ptr);
+    /* region updates don't rotate the renaming slot, the next sg_update_image()
+       overwrites the entire content of the next slot anyway
+    */
+    __unsafe_unretained id<MTLTexture> mtl_tex = _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]);
+    MTLRegion region;
+    NSUInteger mtl_slice_index = 0;
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        region = MTLRegionMake3D((NSUInteger)x, (NSUInteger)y, (NSUInteger)slice, (NSUInteger)width, (NSUInteger)height, 1);
+    }
+    else {
+        region = MTLRegionMake2D((NSUInteger)x, (NSUInteger)y, (NSUInteger)width, (NSUInteger)height);
+        mtl_slice_index = (NSUInteger)slice;
+    }
+    [mtl_tex replaceRegion:region
+        mipmapLevel:(NSUInteger)mip_level
+        slice:mtl_slice_index
+        withBytes:data->ptr
+        bytesPerRow:(NSUInteger)row_pitch
+        bytesPerImage:(NSUInteger)(row_pitch * height)];
+}
+
 /*== WEBGPU BACKEND IMPLEMENTATION ===========================================*/
 #elif defined(SOKOL_WGPU)
 
@@ -11364,6 +11560,54 @@ _SOKOL_PRIVATE bool _sg_wgpu_staging_copy_to_texture(_sg_image_t* img, const sg_
     return true;
 }
 
+_SOKOL_PRIVATE bool _sg_wgpu_staging_copy_to_texture_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    /* similar to _sg_wgpu_staging_copy_to_texture(), but only for a region of one mip level and slice */
+    SOKOL_ASSERT(_sg.wgpu.staging_cmd_enc);
+    const uint32_t src_bytes_per_row = (uint32_t)_sg_row_pitch(img->cmn.pixel_format, width, 1);
+    const uint32_t dst_bytes_per_row = (uint32_t)_sg_row_pitch(img->cmn.pixel_format, width, _SG_WGPU_ROWPITCH_ALIGN);
+    const uint32_t num_bytes = dst_bytes_per_row * (uint32_t)height;
+    if ((_sg.wgpu.staging.offset + num_bytes) >= _sg.wgpu.staging.num_bytes) {
+        SOKOL_LOG("WGPU: Per frame staging buffer full (in _sg_wgpu_staging_copy_to_texture_region)!\n");
+        return false;
+    }
+    const int cur = _sg.wgpu.staging.cur;
+    SOKOL_ASSERT(_sg.wgpu.staging.ptr[cur]);
+    uint32_t stg_offset = _sg.wgpu.staging.offset;
+    uint8_t* dst_ptr = _sg.wgpu.staging.ptr[cur] + stg_offset;
+    const uint8_t* src_ptr = (const uint8_t*) data->ptr;
+    for (int row_index = 0; row_index < height; row_index++) {
+        memcpy(dst_ptr, src_ptr, src_bytes_per_row);
+        src_ptr += row_pitch;
+        dst_ptr += dst_bytes_per_row;
+    }
+    WGPUBufferCopyView src_view;
+    memset(&src_view, 0, sizeof(src_view));
+    src_view.buffer = _sg.wgpu.staging.buf[cur];
+    src_view.offset = stg_offset;
+    src_view.rowPitch = dst_bytes_per_row;
+    src_view.imageHeight = (uint32_t)height;
+    WGPUTextureCopyView dst_view;
+    memset(&dst_view, 0, sizeof(dst_view));
+    dst_view.texture = img->wgpu.tex;
+    dst_view.mipLevel = (uint32_t)mip_level;
+    dst_view.origin.x = (uint32_t)x;
+    dst_view.origin.y = (uint32_t)y;
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        dst_view.origin.z = (uint32_t)slice;
+    }
+    else {
+        dst_view.arrayLayer = (uint32_t)slice;
+    }
+    WGPUExtent3D extent;
+    memset(&extent, 0, sizeof(extent));
+    extent.width = (uint32_t)width;
+    extent.height = (uint32_t)height;
+    extent.depth = 1;
+    wgpuCommandEncoderCopyBufferToTexture(_sg.wgpu.staging_cmd_enc, &src_view, &dst_view, &extent);
+    _sg.wgpu.staging.offset = _sg_roundup(stg_offset + num_bytes, _SG_WGPU_STAGING_ALIGN);
+    return true;
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_staging_unmap(void) {
     /* called at end of frame before queue-submit */
     const int cur = _sg.wgpu.staging.cur;
@@ -12298,6 +12542,13 @@ _SOKOL_PRIVATE void _sg_wgpu_update_image(_sg_image_t* img, const sg_image_data*
     SOKOL_ASSERT(success);
     _SOKOL_UNUSED(success);
 }
+
+_SOKOL_PRIVATE void _sg_wgpu_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(img && data && data->ptr);
+    bool success = _sg_wgpu_staging_copy_to_texture_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    SOKOL_ASSERT(success);
+    _SOKOL_UNUSED(success);
+}
 #endif
 
 /*== BACKEND API WRAPPERS ====================================================*/
@@ -12787,6 +13038,22 @@ static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data)
     #endif
 }
 
+static inline void _sg_update_image_region(_sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
 /*== RESOURCE POOLS ==========================================================*/
 
 _SOKOL_PRIVATE void _sg_init_pool(_sg_pool_t* pool, int num) {
@@ -13175,6 +13442,7 @@ _SOKOL_PRIVATE const char* _sg_validate_string(_sg_validate_error_t err) {
         case _SG_VALIDATE_IMAGEDESC_RT_NO_DATA:         return "render target images cannot be initialized with data";
         case _SG_VALIDATE_IMAGEDESC_DATA:               return "missing or invalid data for immutable image";
         case _SG_VALIDATE_IMAGEDESC_NO_DATA:            return "dynamic/stream usage images cannot be initialized with data";
+        case _SG_VALIDATE_IMAGEDESC_REGIONUPDATES_USAGE: return "sg_image_desc.region_updates requires SG_USAGE_DYNAMIC";
 
         /* shader creation */
         case _SG_VALIDATE_SHADERDESC_CANARY:                return "sg_shader_desc not initialized";
@@ -13274,6 +13542,16 @@ _SOKOL_PRIVATE const char* _sg_validate_string(_sg_validate_error_t err) {
         case _SG_VALIDATE_UPDIMG_COMPRESSED:    return "sg_update_image: cannot update images with compressed format";
         case _SG_VALIDATE_UPDIMG_ONCE:          return "sg_update_image: only one update allowed per image and frame";
 
+        /* sg_update_image_region */
+        case _SG_VALIDATE_UPDIMGREGION_USAGE:           return "sg_update_image_region: image must have been created with SG_USAGE_DYNAMIC";
+        case _SG_VALIDATE_UPDIMGREGION_NOT_ENABLED:     return "sg_update_image_region: image must have been created with sg_image_desc.region_updates = true";
+        case _SG_VALIDATE_UPDIMGREGION_COMPRESSED:      return "sg_update_image_region: cannot update images with compressed format";
+        case _SG_VALIDATE_UPDIMGREGION_MIPLEVEL:        return "sg_update_image_region: mip level out of range";
+        case _SG_VALIDATE_UPDIMGREGION_SLICE:           return "sg_update_image_region: slice (or cubemap face) out of range";
+        case _SG_VALIDATE_UPDIMGREGION_RECT:            return "sg_update_image_region: region is empty or outside the mip level";
+        case _SG_VALIDATE_UPDIMGREGION_ROWPITCH:        return "sg_update_image_region: row pitch too small or not a multiple of the pixel size";
+        case _SG_VALIDATE_UPDIMGREGION_NOTENOUGHDATA:   return "sg_update_image_region: not enough data provided";
+
         default: return "unknown validation error";
     }
 }
@@ -13342,6 +13620,7 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
         SOKOL_VALIDATE(desc->_end_canary == 0, _SG_VALIDATE_IMAGEDESC_CANARY);
         SOKOL_VALIDATE(desc->width > 0, _SG_VALIDATE_IMAGEDESC_WIDTH);
         SOKOL_VALIDATE(desc->height > 0, _SG_VALIDATE_IMAGEDESC_HEIGHT);
+        SOKOL_VALIDATE(!desc->region_updates || (desc->usage == SG_USAGE_DYNAMIC), _SG_VALIDATE_IMAGEDESC_REGIONUPDATES_USAGE);
         const sg_pixel_format fmt = desc->pixel_format;
         const sg_usage usage = desc->usage;
         const bool injected = (0 != desc->gl_textures[0]) ||
@@ -13850,6 +14129,46 @@ _SOKOL_PRIVATE bool _sg_validate_update_image(const _sg_image_t* img, const sg_i
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_update_image_region(const _sg_image_t* img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(mip_level);
+        _SOKOL_UNUSED(slice);
+        _SOKOL_UNUSED(x);
+        _SOKOL_UNUSED(y);
+        _SOKOL_UNUSED(width);
+        _SOKOL_UNUSED(height);
+        _SOKOL_UNUSED(data);
+        _SOKOL_UNUSED(row_pitch);
+        return true;
+    #else
+        SOKOL_ASSERT(img && data);
+        SOKOL_VALIDATE_BEGIN();
+        SOKOL_VALIDATE(img->cmn.usage == SG_USAGE_DYNAMIC, _SG_VALIDATE_UPDIMGREGION_USAGE);
+        SOKOL_VALIDATE(img->cmn.region_updates, _SG_VALIDATE_UPDIMGREGION_NOT_ENABLED);
+        SOKOL_VALIDATE(!_sg_is_compressed_pixel_format(img->cmn.pixel_format), _SG_VALIDATE_UPDIMGREGION_COMPRESSED);
+        SOKOL_VALIDATE((mip_level >= 0) && (mip_level < img->cmn.num_mipmaps), _SG_VALIDATE_UPDIMGREGION_MIPLEVEL);
+        int num_slices = 1;
+        switch (img->cmn.type) {
+            case SG_IMAGETYPE_CUBE:     num_slices = 6; break;
+            case SG_IMAGETYPE_3D:       num_slices = _sg_max(img->cmn.num_slices >> mip_level, 1); break;
+            case SG_IMAGETYPE_ARRAY:    num_slices = img->cmn.num_slices; break;
+            default:                    break;
+        }
+        SOKOL_VALIDATE((slice >= 0) && (slice < num_slices), _SG_VALIDATE_UPDIMGREGION_SLICE);
+        const int mip_width = _sg_max(img->cmn.width >> mip_level, 1);
+        const int mip_height = _sg_max(img->cmn.height >> mip_level, 1);
+        SOKOL_VALIDATE((x >= 0) && (y >= 0) && (width > 0) && (height > 0), _SG_VALIDATE_UPDIMGREGION_RECT);
+        SOKOL_VALIDATE(((x + width) <= mip_width) && ((y + height) <= mip_height), _SG_VALIDATE_UPDIMGREGION_RECT);
+        const int bytes_per_row = _sg_row_pitch(img->cmn.pixel_format, width, 1);
+        SOKOL_VALIDATE(row_pitch >= bytes_per_row, _SG_VALIDATE_UPDIMGREGION_ROWPITCH);
+        SOKOL_VALIDATE((row_pitch % _sg_pixelformat_bytesize(img->cmn.pixel_format)) == 0, _SG_VALIDATE_UPDIMGREGION_ROWPITCH);
+        SOKOL_VALIDATE(0 != data->ptr, _SG_VALIDATE_UPDIMGREGION_NOTENOUGHDATA);
+        SOKOL_VALIDATE(data->size >= (size_t)((height - 1) * row_pitch + bytes_per_row), _SG_VALIDATE_UPDIMGREGION_NOTENOUGHDATA);
+        return SOKOL_VALIDATE_END();
+    #endif
+}
+
 /*== fill in desc default values =============================================*/
 _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* desc) {
     sg_buffer_desc def = *desc;
@@ -15112,6 +15431,20 @@ SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data)
     _SG_TRACE_ARGS(update_image, img_id, data);
 }
 
+SOKOL_API_IMPL void sg_update_image_region(sg_image img_id, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(data);
+    _sg_image_t* img = _sg_lookup_image(&_sg.pools, img_id.id);
+    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+        /* a row pitch of zero means tightly packed rows */
+        const int pitch = (0 == row_pitch) ? _sg_row_pitch(img->cmn.pixel_format, width, 1) : row_pitch;
+        if (_sg_validate_update_image_region(img, mip_level, slice, x, y, width, height, data, pitch)) {
+            _sg_update_image_region(img, mip_level, slice, x, y, width, height, data, pitch);
+        }
+    }
+    _SG_TRACE_ARGS(update_image_region, img_id, mip_level, slice, x, y, width, height, data, row_pitch);
+}
+
 SOKOL_API_IMPL void sg_push_debug_group(const char* name) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(name);
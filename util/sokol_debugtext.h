@@ -35,6 +35,7 @@
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
     SOKOL_LOG(msg)      - your own logging function (default: puts(msg))
     SOKOL_UNREACHABLE() - a guard macro for unreachable code (default: assert(false))
+    SDTX_NO_SIMD        - don't use SSE2/NEON code paths for scanning strings
 
     If sokol_debugtext.h is compiled as a DLL, define the following before
     including the declaration or implementation:
@@ -70,7 +71,8 @@
 
         .printf_buf_size (default: 4096)
             The size of the internal text formatting buffer used by
-            sdtx_printf() and sdtx_vprintf().
+            sdtx_printf() and sdtx_vprintf() (each context has its own
+            formatting buffer of this size).
 
         .fonts (default: none)
             An array of sdtx_font_desc_t structs used to configure the
@@ -255,6 +257,7 @@
         .color_format       -- color pixel format of target render pass
         .depth_format       -- depth pixel format of target render pass
         .sample_count       -- MSAA sample count of target render pass
+        .retained           -- skip the GPU upload when the text is unchanged, default: false
 
     To make a new context the active context, call:
 
@@ -289,6 +292,117 @@
     If a context is set as active that no longer exists, all sokol-debugtext
     functions that require an active context will silently fail.
 
+    RETAINED TEXT LAYERS
+    ====================
+    A text context usually copies all recorded characters into its vertex
+    buffer in each sdtx_draw(). For text which rarely changes (like a help
+    screen, or a table which is updated once per second) this upload can be
+    skipped by creating the context in retained mode:
+
+        sdtx_context ctx = sdtx_make_context(&(sdtx_context_desc_t){
+            .retained = true,
+            ...
+        });
+
+    The text must still be recorded each frame as usual, but sdtx_draw()
+    computes a hash of the recorded glyph data and only updates the vertex
+    buffer when the hash differs from the last uploaded data, otherwise the
+    vertex buffer content from the previous frame is rendered again.
+
+    To force an upload in the next sdtx_draw() (for instance to rule out
+    the astronomically unlikely case of a hash collision in a critical
+    frame) call:
+
+        sdtx_mark_dirty();
+
+    Note that a retained context can only upload new text once per frame:
+    the vertex buffer is updated with sg_update_buffer() instead of being
+    appended to, and sokol-gfx only allows one update per buffer and frame.
+    Drawing a retained context several times in the same frame (for
+    instance in two render passes or viewports) works as long as the text
+    doesn't change between the sdtx_draw() calls. If the text is changed
+    and drawn again in the same frame, the second upload fails sokol-gfx's
+    validation in debug mode, and the rendered result is undefined in
+    release mode. Use a separate context for each pass in this case, or a
+    regular (non-retained) context which appends its vertex data in each
+    sdtx_draw().
+
+    INSTANCED GLYPH RENDERING
+    =========================
+    When the sokol-gfx backend supports instancing, each character is
+    recorded as a single 12-byte instance (position in 1/32 character cells,
+    character code, font index and color) which is expanded into a quad in
+    the vertex shader, instead of 6 vertices with 16 bytes each. This
+    reduces the vertex data that needs to be written and uploaded per
+    character by a factor of 8.
+
+    The character positions are stored as 16-bit fixed point values, so
+    characters must be within -1023..+1023 character cells of the canvas
+    origin (which should never be a problem for on-screen text).
+
+    The glyph size is passed to the shader as a uniform, so each call to
+    sdtx_canvas() with characters already recorded in the same frame
+    starts a new draw call (up to 16 per context and frame, after that
+    the last canvas size applies to the remaining characters).
+
+    The instanced path isn't available in the WebGPU backend (there's no
+    SPIR-V byte code for the instancing shader), on GLES2 without the
+    instanced-arrays extension, if the shader fails to compile, or when a
+    bitmap font atlas is used (see USING BITMAP FONT ATLASES below), in
+    those cases sokol-debugtext falls back to the regular per-vertex
+    rendering.
+
+    FILLING CONTEXTS FROM MULTIPLE THREADS
+    ======================================
+    The current context set with sdtx_set_context() is global state, so
+    the regular text output functions can only be used from one thread.
+    For filling different contexts on different threads, all functions
+    which operate on the current context also have a variant which takes
+    an explicit context handle as first parameter:
+
+        sdtx_context_font(ctx, font_index)
+        sdtx_context_canvas(ctx, w, h)
+        sdtx_context_origin(ctx, x, y)
+        sdtx_context_home(ctx)
+        sdtx_context_pos(ctx, x, y)
+        sdtx_context_pos_x(ctx, x)
+        sdtx_context_pos_y(ctx, y)
+        sdtx_context_move(ctx, dx, dy)
+        sdtx_context_move_x(ctx, dx)
+        sdtx_context_move_y(ctx, dy)
+        sdtx_context_crlf(ctx)
+        sdtx_context_color3b(ctx, r, g, b)
+        sdtx_context_color3f(ctx, r, g, b)
+        sdtx_context_color4b(ctx, r, g, b, a)
+        sdtx_context_color4f(ctx, r, g, b, a)
+        sdtx_context_color1i(ctx, rgba)
+        sdtx_context_putc(ctx, c)
+        sdtx_context_puts(ctx, str)
+        sdtx_context_putr(ctx, str, len)
+        sdtx_context_printf(ctx, fmt, ...)
+        sdtx_context_vprintf(ctx, fmt, args)
+        sdtx_context_mark_dirty(ctx)
+        sdtx_context_draw(ctx)
+
+    Each context has its own printf formatting buffer, so different contexts
+    can be filled concurrently from different threads, for instance one
+    context per worker thread:
+
+        // on a worker thread:
+        sdtx_context_canvas(ctx, w, h);
+        sdtx_context_printf(ctx, "%s: %.2f ms\n", name, time_ms);
+
+        // on the render thread, after the workers have finished:
+        sdtx_context_draw(ctx);
+
+    The following rules apply:
+
+        - a context must only be used by one thread at a time
+        - contexts must not be created or destroyed while other threads
+          are filling contexts
+        - sdtx_context_draw() calls into sokol-gfx, so it must be called
+          on the thread which renders with sokol-gfx
+
     USING YOUR OWN FONT DATA
     ========================
 
@@ -365,6 +479,58 @@
     Character tiles that haven't been defined in the font will be rendered
     as a solid 8x8 quad.
 
+    USING BITMAP FONT ATLASES
+    =========================
+    For more readable text (for instance in long log views) a font slot
+    can also be populated with a pre-rasterized bitmap font atlas with
+    proportional glyphs, like the output of the BMFont tool or similar
+    font atlas generators:
+
+        sdtx_setup(&sdtx_desc_t){
+            .fonts = {
+                [0] = sdtx_font_kc853(),
+                [1] = {
+                    .first_char = 32,
+                    .last_char = 126,
+                    .atlas = {
+                        .pixels = SDTX_RANGE(my_atlas_pixels),
+                        .width = 256,
+                        .height = 128,
+                        .line_height = 14,
+                        .glyphs = my_glyphs
+                    }
+                }
+            }
+        });
+
+    The atlas pixels are 8-bit alpha values (one byte per pixel), the atlas
+    image must not be wider than 2048 pixels. 'my_glyphs' is an array of
+    sdtx_glyph_t items, one for each character from .first_char to
+    .last_char, with the glyph position and size in the atlas image, the
+    offset of the glyph from the cursor position (where the y-offset is
+    relative to the top of the line) and the horizontal cursor advance,
+    all in pixels (this is the same information as in the 'char' lines
+    of a BMFont .fnt file, note that kerning pairs are not supported).
+
+    One atlas pixel covers one pixel of the virtual canvas, just like the
+    8x8 fonts, and the cursor position is still measured in 8x8 character
+    cells (so sdtx_pos() etc. work the same for all fonts). A newline or
+    sdtx_crlf() moves the cursor down by the .line_height of the current
+    font, and a space advances the cursor by the advance of the font's
+    space glyph (so make sure that the atlas contains a glyph for the
+    space character). Characters which are not in the atlas are not
+    rendered and don't advance the cursor.
+
+    The glyph metrics are converted into a per-font table of character
+    cell offsets, sizes, advances and texture coordinates in sdtx_setup(),
+    so the layout of a proportional font only costs one table lookup and
+    an addition per character.
+
+    All atlas images are copied into the same font texture as the 8x8
+    fonts, so all fonts are still rendered with one draw call per context.
+    Since the instanced rendering path only knows about 8x8 character
+    tiles, it is disabled when any font slot uses a bitmap font atlas.
+
     LICENSE
     =======
     zlib/libpng license
@@ -415,8 +581,10 @@
 
 #if defined(__GNUC__)
 #define SOKOL_DEBUGTEXT_PRINTF_ATTR __attribute__((format(printf, 1, 2)))
+#define SOKOL_DEBUGTEXT_CONTEXT_PRINTF_ATTR __attribute__((format(printf, 2, 3)))
 #else
 #define SOKOL_DEBUGTEXT_PRINTF_ATTR
+#define SOKOL_DEBUGTEXT_CONTEXT_PRINTF_ATTR
 #endif
 
 #ifdef __cplusplus
@@ -451,6 +619,36 @@ typedef struct sdtx_range {
 #define SDTX_RANGE(x) (sdtx_range){ &x, sizeof(x) }
 #endif
 
+/*
+    sdtx_glyph_t
+
+    Describes one character in a bitmap font atlas image, these are the
+    same values as in the 'char' lines of a BMFont .fnt file, all values
+    are in pixels.
+*/
+typedef struct sdtx_glyph_t {
+    uint16_t x, y;              // top-left corner of the glyph in the atlas image
+    uint16_t width, height;     // size of the glyph in the atlas image
+    int16_t offset_x;           // horizontal offset from the cursor position to the glyph
+    int16_t offset_y;           // vertical offset from the top of the line to the glyph
+    int16_t advance;            // horizontal cursor advance after the glyph
+} sdtx_glyph_t;
+
+/*
+    sdtx_font_atlas_t
+
+    Describes a pre-rasterized bitmap font atlas with proportional
+    glyphs, used instead of 8x8 character tiles (see USING BITMAP FONT
+    ATLASES in the documentation header).
+*/
+typedef struct sdtx_font_atlas_t {
+    sdtx_range pixels;          // 8 bits-per-pixel alpha values of the atlas image (width * height bytes)
+    int width;                  // width of the atlas image in pixels (max 2048)
+    int height;                 // height of the atlas image in pixels
+    int line_height;            // vertical cursor advance of a new line in pixels (default: 8)
+    const sdtx_glyph_t* glyphs; // glyph descriptions for first_char..last_char
+} sdtx_font_atlas_t;
+
 /*
     sdtx_font_desc_t
 
@@ -471,6 +669,9 @@ typedef struct sdtx_range {
         . X X . . X X .     byte 5: 0x66
         . X X . . X X .     byte 6: 0x66
         . . . . . . . .     byte 7: 0x00
+
+    Alternatively a font can be described by a bitmap font atlas
+    (see sdtx_font_atlas_t above).
  */
 #define SDTX_MAX_FONTS (8)
 
@@ -478,6 +679,7 @@ typedef struct sdtx_font_desc_t {
     sdtx_range data;        // pointer to and size of font pixel data
     uint8_t first_char;     // first character index in font pixel data
     uint8_t last_char;      // last character index in font pixel data, inclusive (default: 255)
+    sdtx_font_atlas_t atlas;    // alternatively: a bitmap font atlas with proportional glyphs
 } sdtx_font_desc_t;
 
 /*
@@ -496,6 +698,7 @@ typedef struct sdtx_context_desc_t {
     sg_pixel_format color_format;           // color pixel format of target render pass
     sg_pixel_format depth_format;           // depth pixel format of target render pass
     int sample_count;                       // MSAA sample count of target render pass
+    bool retained;                          // only upload text to the GPU when it has changed (at most once per frame), default: false
 } sdtx_context_desc_t;
 
 /*
@@ -516,7 +719,7 @@ typedef struct sdtx_context_desc_t {
 */
 typedef struct sdtx_desc_t {
     int context_pool_size;                  // max number of rendering contexts that can be created, default: 8
-    int printf_buf_size;                    // size of internal buffer for snprintf(), default: 4096
+    int printf_buf_size;                    // size of per-context buffer for snprintf(), default: 4096
     sdtx_font_desc_t fonts[SDTX_MAX_FONTS]; // up to 8 fonts descriptions
     sdtx_context_desc_t context;            // the default context creation parameters
 } sdtx_desc_t;
@@ -542,6 +745,9 @@ SOKOL_DEBUGTEXT_API_DECL sdtx_context sdtx_get_context(void);
 /* draw and rewind the current context */
 SOKOL_DEBUGTEXT_API_DECL void sdtx_draw(void);
 
+/* force a GPU upload in the next sdtx_draw() of the current (retained) context */
+SOKOL_DEBUGTEXT_API_DECL void sdtx_mark_dirty(void);
+
 /* switch to a different font */
 SOKOL_DEBUGTEXT_API_DECL void sdtx_font(int font_index);
 
@@ -575,6 +781,31 @@ SOKOL_DEBUGTEXT_API_DECL void sdtx_putr(const char* str, int len);    // 'put ra
 SOKOL_DEBUGTEXT_API_DECL int sdtx_printf(const char* fmt, ...) SOKOL_DEBUGTEXT_PRINTF_ATTR;
 SOKOL_DEBUGTEXT_API_DECL int sdtx_vprintf(const char* fmt, va_list args);
 
+/* explicit-context variants of the above (see FILLING CONTEXTS FROM MULTIPLE THREADS) */
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_draw(sdtx_context ctx);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_mark_dirty(sdtx_context ctx);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_font(sdtx_context ctx, int font_index);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_canvas(sdtx_context ctx, float w, float h);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_origin(sdtx_context ctx, float x, float y);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_home(sdtx_context ctx);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_pos(sdtx_context ctx, float x, float y);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_pos_x(sdtx_context ctx, float x);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_pos_y(sdtx_context ctx, float y);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_move(sdtx_context ctx, float dx, float dy);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_move_x(sdtx_context ctx, float dx);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_move_y(sdtx_context ctx, float dy);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_crlf(sdtx_context ctx);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_color3b(sdtx_context ctx, uint8_t r, uint8_t g, uint8_t b);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_color3f(sdtx_context ctx, float r, float g, float b);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_color4b(sdtx_context ctx, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_color4f(sdtx_context ctx, float r, float g, float b, float a);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_color1i(sdtx_context ctx, uint32_t rgba);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_putc(sdtx_context ctx, char chr);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_puts(sdtx_context ctx, const char* str);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_putr(sdtx_context ctx, const char* str, int len);
+SOKOL_DEBUGTEXT_API_DECL int sdtx_context_printf(sdtx_context ctx, const char* fmt, ...) SOKOL_DEBUGTEXT_CONTEXT_PRINTF_ATTR;
+SOKOL_DEBUGTEXT_API_DECL int sdtx_context_vprintf(sdtx_context ctx, const char* fmt, va_list args);
+
 #ifdef __cplusplus
 } /* extern "C" */
 /* C++ const-ref wrappers */
@@ -587,10 +818,20 @@ inline sdtx_context sdtx_make_context(const sdtx_context_desc_t& desc) { return
 #ifdef SOKOL_DEBUGTEXT_IMPL
 #define SOKOL_DEBUGTEXT_IMPL_INCLUDED (1)
 
-#include <string.h> // memset
+#include <string.h> // memset, strlen, memchr
 #include <math.h>   // fmodf
 #include <stdarg.h> // for vsnprintf
 
+#if !defined(SDTX_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define _SDTX_SSE2 (1)
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #define _SDTX_NEON (1)
+        #include <arm_neon.h>
+    #endif
+#endif
+
 #ifndef SOKOL_API_IMPL
     #define SOKOL_API_IMPL
 #endif
@@ -638,6 +879,7 @@ inline sdtx_context sdtx_make_context(const sdtx_context_desc_t& desc) { return
 #define _SDTX_DEFAULT_CANVAS_HEIGHT (480)
 #define _SDTX_DEFAULT_TAB_WIDTH (4)
 #define _SDTX_DEFAULT_COLOR (0xFF00FFFF)
+#define _SDTX_INITIAL_NUM_BATCHES (16)
 #define _SDTX_INVALID_SLOT_INDEX (0)
 #define _SDTX_SLOT_SHIFT (16)
 #define _SDTX_MAX_POOL_SIZE (1<<_SDTX_SLOT_SHIFT)
@@ -3369,6 +3611,155 @@ static const char* _sdtx_fs_src_dummy = "";
 #error "Please define one of SOKOL_GLCORE33, SOKOL_GLES2, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU or SOKOL_DUMMY_BACKEND!"
 #endif
 
+/*
+    Shader for instanced glyph rendering (see INSTANCED GLYPH RENDERING), each
+    instance is one character which is expanded into a quad through a small
+    per-vertex buffer with the 6 corner positions. These are embedded as
+    source code since there's no byte code for them, there's no WGPU version
+    (WGPU requires SPIR-V byte code), instead the WGPU backend uses the
+    regular per-vertex path.
+
+    The glyph attribute is a SHORT4N (x, y, character code, font index) with
+    the glyph position in 1/32 character cells, vs_params.xy is the glyph
+    size in 0..1 screen space.
+
+        @vs vs_inst
+        uniform vs_params {
+            vec4 vs_params;
+        };
+        in vec4 glyph;
+        in vec4 color0;
+        in vec2 corner;
+        out vec2 uv;
+        out vec4 color;
+        void main() {
+          vec4 g = glyph * 32767.0;
+          vec2 pos = (g.xy * (1.0 / 32.0) + corner) * vs_params.xy;
+          gl_Position = vec4(pos * vec2(2.0, -2.0) + vec2(-1.0, +1.0), 0.0, 1.0);
+          uv = (floor(g.zw + 0.5) + corner) * vec2(1.0 / 256.0, 1.0 / 8.0);
+          color = color0;
+        }
+        @end
+
+    The fragment shader is the same as above.
+*/
+#if defined(SOKOL_GLCORE33)
+static const char* _sdtx_inst_vs_src_glcore33 =
+    "#version 330\n"
+    "uniform vec4 vs_params[1];\n"
+    "layout(location = 0) in vec4 glyph;\n"
+    "layout(location = 1) in vec4 color0;\n"
+    "layout(location = 2) in vec2 corner;\n"
+    "out vec2 uv;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    vec4 g = glyph * 32767.0;\n"
+    "    vec2 pos = (g.xy * (1.0 / 32.0) + corner) * vs_params[0].xy;\n"
+    "    gl_Position = vec4(pos * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0, 1.0);\n"
+    "    uv = (floor(g.zw + 0.5) + corner) * vec2(1.0 / 256.0, 1.0 / 8.0);\n"
+    "    color = color0;\n"
+    "}\n";
+static const char* _sdtx_inst_fs_src_glcore33 =
+    "#version 330\n"
+    "uniform sampler2D tex;\n"
+    "layout(location = 0) out vec4 frag_color;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "void main() {\n"
+    "    frag_color = texture(tex, uv).xxxx * color;\n"
+    "}\n";
+#elif defined(SOKOL_GLES2) || defined(SOKOL_GLES3)
+static const char* _sdtx_inst_vs_src_gles2 =
+    "#version 100\n"
+    "uniform vec4 vs_params[1];\n"
+    "attribute vec4 glyph;\n"
+    "attribute vec4 color0;\n"
+    "attribute vec2 corner;\n"
+    "varying vec2 uv;\n"
+    "varying vec4 color;\n"
+    "void main() {\n"
+    "    vec4 g = glyph * 32767.0;\n"
+    "    vec2 pos = (g.xy * (1.0 / 32.0) + corner) * vs_params[0].xy;\n"
+    "    gl_Position = vec4(pos * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0, 1.0);\n"
+    "    uv = (floor(g.zw + 0.5) + corner) * vec2(1.0 / 256.0, 1.0 / 8.0);\n"
+    "    color = color0;\n"
+    "}\n";
+static const char* _sdtx_inst_fs_src_gles2 =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform highp sampler2D tex;\n"
+    "varying highp vec2 uv;\n"
+    "varying highp vec4 color;\n"
+    "void main() {\n"
+    "    gl_FragData[0] = texture2D(tex, uv).xxxx * color;\n"
+    "}\n";
+#elif defined(SOKOL_METAL)
+static const char* _sdtx_inst_vs_src_metal =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "struct vs_params { float4 glyph_size; };\n"
+    "struct vs_in {\n"
+    "    float4 glyph [[attribute(0)]];\n"
+    "    float4 color0 [[attribute(1)]];\n"
+    "    float2 corner [[attribute(2)]];\n"
+    "};\n"
+    "struct vs_out {\n"
+    "    float2 uv [[user(locn0)]];\n"
+    "    float4 color [[user(locn1)]];\n"
+    "    float4 pos [[position]];\n"
+    "};\n"
+    "vertex vs_out main0(vs_in in [[stage_in]], constant vs_params& params [[buffer(0)]]) {\n"
+    "    vs_out out;\n"
+    "    float4 g = in.glyph * 32767.0;\n"
+    "    float2 pos = (g.xy * (1.0 / 32.0) + in.corner) * params.glyph_size.xy;\n"
+    "    out.pos = float4(pos * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);\n"
+    "    out.uv = (floor(g.zw + 0.5) + in.corner) * float2(1.0 / 256.0, 1.0 / 8.0);\n"
+    "    out.color = in.color0;\n"
+    "    return out;\n"
+    "}\n";
+static const char* _sdtx_inst_fs_src_metal =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "struct fs_in {\n"
+    "    float2 uv [[user(locn0)]];\n"
+    "    float4 color [[user(locn1)]];\n"
+    "};\n"
+    "fragment float4 main0(fs_in in [[stage_in]], texture2d<float> tex [[texture(0)]], sampler smp [[sampler(0)]]) {\n"
+    "    return tex.sample(smp, in.uv).xxxx * in.color;\n"
+    "}\n";
+#elif defined(SOKOL_D3D11)
+static const char* _sdtx_inst_vs_src_hlsl4 =
+    "cbuffer params : register(b0) { float4 vs_params; };\n"
+    "struct vs_in {\n"
+    "    float4 glyph : TEXCOORD0;\n"
+    "    float4 color0 : TEXCOORD1;\n"
+    "    float2 corner : TEXCOORD2;\n"
+    "};\n"
+    "struct vs_out {\n"
+    "    float2 uv : TEXCOORD0;\n"
+    "    float4 color : TEXCOORD1;\n"
+    "    float4 pos : SV_Position;\n"
+    "};\n"
+    "vs_out main(vs_in inp) {\n"
+    "    vs_out outp;\n"
+    "    float4 g = inp.glyph * 32767.0;\n"
+    "    float2 pos = (g.xy * (1.0 / 32.0) + inp.corner) * vs_params.xy;\n"
+    "    outp.pos = float4(pos * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);\n"
+    "    outp.uv = (floor(g.zw + 0.5) + inp.corner) * float2(1.0 / 256.0, 1.0 / 8.0);\n"
+    "    outp.color = inp.color0;\n"
+    "    return outp;\n"
+    "}\n";
+static const char* _sdtx_inst_fs_src_hlsl4 =
+    "Texture2D<float4> tex : register(t0);\n"
+    "SamplerState smp : register(s0);\n"
+    "float4 main(float2 uv : TEXCOORD0, float4 color : TEXCOORD1) : SV_Target0 {\n"
+    "    return tex.Sample(smp, uv).xxxx * color;\n"
+    "}\n";
+#elif defined(SOKOL_DUMMY_BACKEND)
+static const char* _sdtx_inst_vs_src_dummy = "";
+static const char* _sdtx_inst_fs_src_dummy = "";
+#endif
+
 typedef struct {
     uint32_t id;
     sg_resource_state state;
@@ -3391,12 +3782,51 @@ typedef struct {
     uint32_t color;
 } _sdtx_vertex_t;
 
+/* one character in the instanced rendering path */
+typedef struct {
+    int16_t x, y;       /* glyph position in 1/32 character cells */
+    int16_t chr;        /* character code */
+    int16_t font;       /* font index */
+    uint32_t color;
+} _sdtx_instance_t;
+
+/* precomputed layout of one character, in character cells and normalized texture coordinates */
+typedef struct {
+    float x, y;             /* offset of the glyph quad from the cursor position */
+    float w, h;             /* size of the glyph quad */
+    float advance;          /* horizontal cursor advance */
+    uint16_t u0, v0, u1, v1;
+} _sdtx_glyph_t;
+
+typedef struct {
+    float line_height;      /* vertical cursor advance of a new line in character cells */
+    _sdtx_glyph_t glyphs[256];
+} _sdtx_font_t;
+
+/* a range of instances rendered with the same glyph size (split by sdtx_canvas()) */
+typedef struct {
+    int first_instance;
+    _sdtx_float2_t glyph_size;
+} _sdtx_batch_t;
+
 typedef struct {
     _sdtx_slot_t slot;
     sdtx_context_desc_t desc;
     _sdtx_vertex_t* cur_vertex_ptr;
     const _sdtx_vertex_t* max_vertex_ptr;
     _sdtx_vertex_t* vertices;
+    bool instanced;
+    _sdtx_instance_t* cur_instance_ptr;
+    const _sdtx_instance_t* max_instance_ptr;
+    _sdtx_instance_t* instances;
+    int num_batches;
+    int max_batches;
+    _sdtx_batch_t* batches; /* grows when more than _SDTX_INITIAL_NUM_BATCHES are needed */
+    bool dirty;             /* retained mode: force upload in next sdtx_draw() */
+    uint64_t hash;          /* retained mode: hash of the uploaded glyph data */
+    size_t uploaded_size;   /* retained mode: size of the uploaded glyph data */
+    uint32_t fmt_buf_size;
+    char* fmt_buf;          /* per-context printf formatting buffer */
     sg_buffer vbuf;
     sg_pipeline pip;
     int cur_font;
@@ -3418,13 +3848,13 @@ typedef struct {
     sdtx_desc_t desc;
     sg_image font_img;
     sg_shader shader;
-    uint32_t fmt_buf_size;
-    char* fmt_buf;
+    sg_shader inst_shader;      /* invalid if instancing isn't supported */
+    sg_buffer corner_vbuf;      /* per-vertex quad corners for instanced rendering */
     sdtx_context def_ctx_id;
     sdtx_context cur_ctx_id;
     _sdtx_context_t* cur_ctx;   // may be 0!
     _sdtx_context_pool_t context_pool;
-    uint8_t font_pixels[SDTX_MAX_FONTS * 256 * 8 * 8];
+    _sdtx_font_t fonts[SDTX_MAX_FONTS];
 } _sdtx_t;
 static _sdtx_t _sdtx;
 
@@ -3594,30 +4024,65 @@ static void _sdtx_init_context(sdtx_context ctx_id, const sdtx_context_desc_t* i
     _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
     SOKOL_ASSERT(ctx);
     ctx->desc = _sdtx_context_desc_defaults(in_desc);
-
-    const int max_vertices = 6 * ctx->desc.char_buf_size;
-    const size_t vbuf_size = (size_t)max_vertices * sizeof(_sdtx_vertex_t);
-    ctx->vertices = (_sdtx_vertex_t*) SOKOL_MALLOC(vbuf_size);
-    SOKOL_ASSERT(ctx->vertices);
-    ctx->cur_vertex_ptr = ctx->vertices;
-    ctx->max_vertex_ptr = ctx->vertices + max_vertices;
+    ctx->instanced = (SG_INVALID_ID != _sdtx.inst_shader.id);
+
+    /* printf formatting buffer */
+    ctx->fmt_buf_size = (uint32_t) _sdtx.desc.printf_buf_size + 1;
+    ctx->fmt_buf = (char*) SOKOL_MALLOC(ctx->fmt_buf_size);
+    SOKOL_ASSERT(ctx->fmt_buf);
+
+    /* instance batches with different glyph sizes */
+    ctx->max_batches = _SDTX_INITIAL_NUM_BATCHES;
+    ctx->batches = (_sdtx_batch_t*) SOKOL_MALLOC((size_t)ctx->max_batches * sizeof(_sdtx_batch_t));
+    SOKOL_ASSERT(ctx->batches);
+
+    size_t vbuf_size;
+    if (ctx->instanced) {
+        /* one 12-byte instance per character */
+        vbuf_size = (size_t)ctx->desc.char_buf_size * sizeof(_sdtx_instance_t);
+        ctx->instances = (_sdtx_instance_t*) SOKOL_MALLOC(vbuf_size);
+        SOKOL_ASSERT(ctx->instances);
+        ctx->cur_instance_ptr = ctx->instances;
+        ctx->max_instance_ptr = ctx->instances + ctx->desc.char_buf_size;
+    }
+    else {
+        /* 6 vertices per character */
+        const int max_vertices = 6 * ctx->desc.char_buf_size;
+        vbuf_size = (size_t)max_vertices * sizeof(_sdtx_vertex_t);
+        ctx->vertices = (_sdtx_vertex_t*) SOKOL_MALLOC(vbuf_size);
+        SOKOL_ASSERT(ctx->vertices);
+        ctx->cur_vertex_ptr = ctx->vertices;
+        ctx->max_vertex_ptr = ctx->vertices + max_vertices;
+    }
 
     sg_buffer_desc vbuf_desc;
     memset(&vbuf_desc, 0, sizeof(vbuf_desc));
     vbuf_desc.size = vbuf_size;
     vbuf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
-    vbuf_desc.usage = SG_USAGE_STREAM;
+    /* retained contexts update their buffer at most once per frame and reuse it otherwise */
+    vbuf_desc.usage = ctx->desc.retained ? SG_USAGE_DYNAMIC : SG_USAGE_STREAM;
     vbuf_desc.label = "sdtx-vbuf";
     ctx->vbuf = sg_make_buffer(&vbuf_desc);
     SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
 
     sg_pipeline_desc pip_desc;
     memset(&pip_desc, 0, sizeof(pip_desc));
-    pip_desc.layout.buffers[0].stride = sizeof(_sdtx_vertex_t);
-    pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2;
-    pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_USHORT2N;
-    pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
-    pip_desc.shader = _sdtx.shader;
+    if (ctx->instanced) {
+        pip_desc.layout.buffers[0].stride = sizeof(_sdtx_instance_t);
+        pip_desc.layout.buffers[0].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+        pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_SHORT4N;
+        pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.layout.attrs[2].buffer_index = 1;
+        pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_FLOAT2;
+        pip_desc.shader = _sdtx.inst_shader;
+    }
+    else {
+        pip_desc.layout.buffers[0].stride = sizeof(_sdtx_vertex_t);
+        pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2;
+        pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_USHORT2N;
+        pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.shader = _sdtx.shader;
+    }
     pip_desc.index_type = SG_INDEXTYPE_NONE;
     pip_desc.sample_count = ctx->desc.sample_count;
     pip_desc.depth.pixel_format = ctx->desc.depth_format;
@@ -3637,6 +4102,10 @@ static void _sdtx_init_context(sdtx_context ctx_id, const sdtx_context_desc_t* i
     ctx->glyph_size.y = 8.0f / ctx->canvas_size.y;
     ctx->tab_width = (float) ctx->desc.tab_width;
     ctx->color = _SDTX_DEFAULT_COLOR;
+    ctx->num_batches = 1;
+    ctx->batches[0].first_instance = 0;
+    ctx->batches[0].glyph_size = ctx->glyph_size;
+    ctx->dirty = true;
 
     sg_pop_debug_group();
 }
@@ -3650,6 +4119,22 @@ static void _sdtx_destroy_context(sdtx_context ctx_id) {
             ctx->cur_vertex_ptr = 0;
             ctx->max_vertex_ptr = 0;
         }
+        if (ctx->fmt_buf) {
+            SOKOL_FREE(ctx->fmt_buf);
+            ctx->fmt_buf = 0;
+        }
+        if (ctx->instances) {
+            SOKOL_FREE(ctx->instances);
+            ctx->instances = 0;
+            ctx->cur_instance_ptr = 0;
+            ctx->max_instance_ptr = 0;
+        }
+        if (ctx->batches) {
+            SOKOL_FREE(ctx->batches);
+            ctx->batches = 0;
+            ctx->num_batches = 0;
+            ctx->max_batches = 0;
+        }
         sg_push_debug_group("sokol_debugtext");
         sg_destroy_buffer(ctx->vbuf);
         sg_destroy_pipeline(ctx->pip);
@@ -3680,12 +4165,71 @@ static void _sdtx_unpack_font(const sdtx_font_desc_t* font_desc, uint8_t* out_pi
     }
 }
 
-static void _sdtx_setup_common(void) {
+/* fonts with a bitmap font atlas can only be rendered through the per-vertex path */
+static bool _sdtx_has_atlas_fonts(void) {
+    for (int i = 0; i < SDTX_MAX_FONTS; i++) {
+        if (_sdtx.desc.fonts[i].atlas.pixels.ptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* convert a texel coordinate into a 16-bit normalized texture coordinate */
+static uint16_t _sdtx_pack_uv(int texel, int size) {
+    const uint32_t uv = ((uint32_t)texel * 0x10000) / (uint32_t)size;
+    return (uv > 0xFFFF) ? 0xFFFF : (uint16_t)uv;
+}
 
-    /* common printf formatting buffer */
-    _sdtx.fmt_buf_size = (uint32_t) _sdtx.desc.printf_buf_size + 1;
-    _sdtx.fmt_buf = (char*) SOKOL_MALLOC(_sdtx.fmt_buf_size);
-    SOKOL_ASSERT(_sdtx.fmt_buf);
+/* glyph layout of the 8x8 character tiles in font texture row 'font_index' */
+static void _sdtx_init_tile_font(_sdtx_font_t* font, int font_index, int img_width, int img_height) {
+    font->line_height = 1.0f;
+    for (int chr = 0; chr < 256; chr++) {
+        _sdtx_glyph_t* g = &font->glyphs[chr];
+        g->x = 0.0f;
+        g->y = 0.0f;
+        g->w = 1.0f;
+        g->h = 1.0f;
+        g->advance = 1.0f;
+        g->u0 = _sdtx_pack_uv(chr * 8, img_width);
+        g->u1 = _sdtx_pack_uv((chr + 1) * 8, img_width);
+        g->v0 = _sdtx_pack_uv(font_index * 8, img_height);
+        g->v1 = _sdtx_pack_uv((font_index + 1) * 8, img_height);
+    }
+}
+
+/* copy a bitmap font atlas into the font texture at row 'atlas_y', and convert its glyph metrics from pixels to character cells */
+static void _sdtx_init_atlas_font(_sdtx_font_t* font, const sdtx_font_desc_t* font_desc, uint8_t* img_pixels, int img_width, int img_height, int atlas_y) {
+    const sdtx_font_atlas_t* atlas = &font_desc->atlas;
+    SOKOL_ASSERT(atlas->pixels.ptr && atlas->glyphs);
+    SOKOL_ASSERT((atlas->width > 0) && (atlas->width <= img_width) && (atlas->height > 0));
+    SOKOL_ASSERT(atlas->pixels.size == (size_t)(atlas->width * atlas->height));
+    SOKOL_ASSERT(font_desc->first_char <= font_desc->last_char);
+    const uint8_t* src = (const uint8_t*) atlas->pixels.ptr;
+    for (int y = 0; y < atlas->height; y++) {
+        memcpy(&img_pixels[(atlas_y + y) * img_width], &src[y * atlas->width], (size_t)atlas->width);
+    }
+    /* characters which are not in the atlas are not rendered and don't advance the cursor */
+    memset(font->glyphs, 0, sizeof(font->glyphs));
+    font->line_height = (float)atlas->line_height / 8.0f;
+    for (int chr = font_desc->first_char; chr <= font_desc->last_char; chr++) {
+        const sdtx_glyph_t* src_glyph = &atlas->glyphs[chr - font_desc->first_char];
+        SOKOL_ASSERT(((int)src_glyph->x + (int)src_glyph->width) <= atlas->width);
+        SOKOL_ASSERT(((int)src_glyph->y + (int)src_glyph->height) <= atlas->height);
+        _sdtx_glyph_t* g = &font->glyphs[chr];
+        g->x = (float)src_glyph->offset_x / 8.0f;
+        g->y = (float)src_glyph->offset_y / 8.0f;
+        g->w = (float)src_glyph->width / 8.0f;
+        g->h = (float)src_glyph->height / 8.0f;
+        g->advance = (float)src_glyph->advance / 8.0f;
+        g->u0 = _sdtx_pack_uv(src_glyph->x, img_width);
+        g->u1 = _sdtx_pack_uv(src_glyph->x + src_glyph->width, img_width);
+        g->v0 = _sdtx_pack_uv(atlas_y + src_glyph->y, img_height);
+        g->v1 = _sdtx_pack_uv(atlas_y + src_glyph->y + src_glyph->height, img_height);
+    }
+}
+
+static void _sdtx_setup_common(void) {
 
     sg_push_debug_group("sokol-debugtext");
 
@@ -3743,28 +4287,116 @@ static void _sdtx_setup_common(void) {
     _sdtx.shader = sg_make_shader(&shd_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sdtx.shader.id);
 
-    /* unpack font data */
-    memset(_sdtx.font_pixels, 0xFF, sizeof(_sdtx.font_pixels));
+    /* shader and corner buffer for instanced rendering (not on WGPU, and only if instancing is supported) */
+    #if !defined(SOKOL_WGPU)
+    if (sg_query_features().instancing && !_sdtx_has_atlas_fonts()) {
+        sg_shader_desc inst_shd_desc;
+        memset(&inst_shd_desc, 0, sizeof(inst_shd_desc));
+        inst_shd_desc.label = "sokol-debugtext-instanced-shader";
+        inst_shd_desc.attrs[0].name = "glyph";
+        inst_shd_desc.attrs[1].name = "color0";
+        inst_shd_desc.attrs[2].name = "corner";
+        for (int i = 0; i < 3; i++) {
+            inst_shd_desc.attrs[i].sem_name = "TEXCOORD";
+            inst_shd_desc.attrs[i].sem_index = i;
+        }
+        inst_shd_desc.vs.uniform_blocks[0].size = 4 * sizeof(float);
+        inst_shd_desc.vs.uniform_blocks[0].uniforms[0].name = "vs_params";
+        inst_shd_desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+        inst_shd_desc.vs.uniform_blocks[0].uniforms[0].array_count = 1;
+        inst_shd_desc.fs.images[0] = shd_desc.fs.images[0];
+        #if defined(SOKOL_GLCORE33)
+            inst_shd_desc.vs.source = _sdtx_inst_vs_src_glcore33;
+            inst_shd_desc.fs.source = _sdtx_inst_fs_src_glcore33;
+        #elif defined(SOKOL_GLES2) || defined(SOKOL_GLES3)
+            inst_shd_desc.vs.source = _sdtx_inst_vs_src_gles2;
+            inst_shd_desc.fs.source = _sdtx_inst_fs_src_gles2;
+        #elif defined(SOKOL_METAL)
+            inst_shd_desc.vs.entry = "main0";
+            inst_shd_desc.fs.entry = "main0";
+            inst_shd_desc.vs.source = _sdtx_inst_vs_src_metal;
+            inst_shd_desc.fs.source = _sdtx_inst_fs_src_metal;
+        #elif defined(SOKOL_D3D11)
+            inst_shd_desc.vs.source = _sdtx_inst_vs_src_hlsl4;
+            inst_shd_desc.fs.source = _sdtx_inst_fs_src_hlsl4;
+        #else
+            inst_shd_desc.vs.source = _sdtx_inst_vs_src_dummy;
+            inst_shd_desc.fs.source = _sdtx_inst_fs_src_dummy;
+        #endif
+        _sdtx.inst_shader = sg_make_shader(&inst_shd_desc);
+        if (SG_RESOURCESTATE_VALID == sg_query_shader_state(_sdtx.inst_shader)) {
+            static const float corners[12] = {
+                0.0f, 0.0f,  1.0f, 0.0f,  1.0f, 1.0f,
+                0.0f, 0.0f,  1.0f, 1.0f,  0.0f, 1.0f
+            };
+            sg_buffer_desc corner_desc;
+            memset(&corner_desc, 0, sizeof(corner_desc));
+            corner_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+            corner_desc.usage = SG_USAGE_IMMUTABLE;
+            corner_desc.data = SG_RANGE(corners);
+            corner_desc.label = "sdtx-corner-vbuf";
+            _sdtx.corner_vbuf = sg_make_buffer(&corner_desc);
+            SOKOL_ASSERT(SG_INVALID_ID != _sdtx.corner_vbuf.id);
+        }
+        else {
+            /* the shader source failed to compile, fall back to per-vertex rendering */
+            SOKOL_LOG("sokol_debugtext.h: failed to create instanced shader, falling back to per-vertex rendering");
+            sg_destroy_shader(_sdtx.inst_shader);
+            _sdtx.inst_shader.id = SG_INVALID_ID;
+        }
+    }
+    #endif
+
+    /* the font texture has one row of 8x8 character tiles per font slot,
+       followed by the bitmap font atlases stacked on top of each other
+    */
+    const int img_width = 256 * 8;
+    const int tiles_height = SDTX_MAX_FONTS * 8;
+    int img_height = tiles_height;
+    for (int i = 0; i < SDTX_MAX_FONTS; i++) {
+        if (_sdtx.desc.fonts[i].atlas.pixels.ptr) {
+            SOKOL_ASSERT(0 == _sdtx.desc.fonts[i].data.ptr);
+            img_height += _sdtx.desc.fonts[i].atlas.height;
+        }
+    }
+    const size_t img_size = (size_t)(img_width * img_height);
+    uint8_t* img_pixels = (uint8_t*) SOKOL_MALLOC(img_size);
+    SOKOL_ASSERT(img_pixels);
+    memset(img_pixels, 0xFF, (size_t)(img_width * tiles_height));
+    memset(img_pixels + img_width * tiles_height, 0x00, img_size - (size_t)(img_width * tiles_height));
+
+    /* unpack font data and precompute the glyph layout */
     const int unpacked_font_size = 256 * 8 * 8;
+    int atlas_y = tiles_height;
     for (int i = 0; i < SDTX_MAX_FONTS; i++) {
-        if (_sdtx.desc.fonts[i].data.ptr) {
-            _sdtx_unpack_font(&_sdtx.desc.fonts[i], &_sdtx.font_pixels[i * unpacked_font_size]);
+        const sdtx_font_desc_t* font_desc = &_sdtx.desc.fonts[i];
+        if (font_desc->atlas.pixels.ptr) {
+            _sdtx_init_atlas_font(&_sdtx.fonts[i], font_desc, img_pixels, img_width, img_height, atlas_y);
+            atlas_y += font_desc->atlas.height;
+        }
+        else {
+            if (font_desc->data.ptr) {
+                _sdtx_unpack_font(font_desc, &img_pixels[i * unpacked_font_size]);
+            }
+            _sdtx_init_tile_font(&_sdtx.fonts[i], i, img_width, img_height);
         }
     }
 
     /* create font texture */
     sg_image_desc img_desc;
     memset(&img_desc, 0, sizeof(img_desc));
-    img_desc.width = 256 * 8;
-    img_desc.height = SDTX_MAX_FONTS * 8;
+    img_desc.width = img_width;
+    img_desc.height = img_height;
     img_desc.pixel_format = SG_PIXELFORMAT_R8;
     img_desc.min_filter = SG_FILTER_NEAREST;
     img_desc.mag_filter = SG_FILTER_NEAREST;
     img_desc.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
     img_desc.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
-    img_desc.data.subimage[0][0] = SG_RANGE(_sdtx.font_pixels);
+    img_desc.data.subimage[0][0].ptr = img_pixels;
+    img_desc.data.subimage[0][0].size = img_size;
     _sdtx.font_img = sg_make_image(&img_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sdtx.font_img.id);
+    SOKOL_FREE(img_pixels);
 
     sg_pop_debug_group();
 }
@@ -3773,10 +4405,8 @@ static void _sdtx_discard_common(void) {
     sg_push_debug_group("sokol-debugtext");
     sg_destroy_image(_sdtx.font_img);
     sg_destroy_shader(_sdtx.shader);
-    if (_sdtx.fmt_buf) {
-        SOKOL_FREE(_sdtx.fmt_buf);
-        _sdtx.fmt_buf = 0;
-    }
+    sg_destroy_shader(_sdtx.inst_shader);
+    sg_destroy_buffer(_sdtx.corner_vbuf);
     sg_pop_debug_group();
 }
 
@@ -3805,37 +4435,43 @@ static inline void _sdtx_ctrl_char(_sdtx_context_t* ctx, uint8_t c) {
             break;
         case '\n':
             ctx->pos.x = 0.0f;
-            ctx->pos.y += 1.0f;
+            ctx->pos.y += _sdtx.fonts[ctx->cur_font].line_height;
             break;
         case '\t':
             ctx->pos.x = (ctx->pos.x - fmodf(ctx->pos.x, ctx->tab_width)) + ctx->tab_width;
             break;
         case ' ':
-            ctx->pos.x += 1.0f;
+            ctx->pos.x += _sdtx.fonts[ctx->cur_font].glyphs[' '].advance;
             break;
     }
 }
 
+/* convert a position in character cells to the 1/32 cell fixed point format of instances */
+static inline int16_t _sdtx_pack_cell_pos(float pos) {
+    return (int16_t) _sdtx_clamp(pos * 32.0f, -32767.0f, 32767.0f);
+}
+
 static inline void _sdtx_draw_char(_sdtx_context_t* ctx, uint8_t c) {
-    if ((ctx->cur_vertex_ptr + 6) <= ctx->max_vertex_ptr) {
-        const float x0 = (ctx->origin.x + ctx->pos.x) * ctx->glyph_size.x;
-        const float y0 = (ctx->origin.y + ctx->pos.y) * ctx->glyph_size.y;
-        const float x1 = x0 + ctx->glyph_size.x;
-        const float y1 = y0 + ctx->glyph_size.y;
-
-        // glyph width and heigth in font texture space
-        const uint16_t uvw = 0x10000 / 0x100;
-        const uint16_t uvh = 0x10000 / SDTX_MAX_FONTS;
-        const uint16_t u0 = ((uint16_t)c) * uvw;
-        const uint16_t v0 = ((uint16_t)ctx->cur_font) * uvh;
-        uint16_t u1 = u0 + uvw;
-        uint16_t v1 = v0 + uvh;
-        if (u1 == 0x0000) {
-            u1 = 0xFFFF;
-        }
-        if (v1 == 0x0000) {
-            v1 = 0xFFFF;
+    const _sdtx_glyph_t* g = &_sdtx.fonts[ctx->cur_font].glyphs[c];
+    if (ctx->instanced) {
+        if (ctx->cur_instance_ptr < ctx->max_instance_ptr) {
+            _sdtx_instance_t* inst = ctx->cur_instance_ptr++;
+            inst->x = _sdtx_pack_cell_pos(ctx->origin.x + ctx->pos.x);
+            inst->y = _sdtx_pack_cell_pos(ctx->origin.y + ctx->pos.y);
+            inst->chr = (int16_t) c;
+            inst->font = (int16_t) ctx->cur_font;
+            inst->color = ctx->color;
         }
+    }
+    else if ((ctx->cur_vertex_ptr + 6) <= ctx->max_vertex_ptr) {
+        const float x0 = (ctx->origin.x + ctx->pos.x + g->x) * ctx->glyph_size.x;
+        const float y0 = (ctx->origin.y + ctx->pos.y + g->y) * ctx->glyph_size.y;
+        const float x1 = x0 + g->w * ctx->glyph_size.x;
+        const float y1 = y0 + g->h * ctx->glyph_size.y;
+        const uint16_t u0 = g->u0;
+        const uint16_t v0 = g->v0;
+        const uint16_t u1 = g->u1;
+        const uint16_t v1 = g->v1;
         const uint32_t color = ctx->color;
 
         // write 6 vertices
@@ -3851,7 +4487,7 @@ static inline void _sdtx_draw_char(_sdtx_context_t* ctx, uint8_t c) {
 
         ctx->cur_vertex_ptr = vx;
     }
-    ctx->pos.x += 1.0f;
+    ctx->pos.x += g->advance;
 }
 
 static inline void _sdtx_put_char(_sdtx_context_t* ctx, char c) {
@@ -3864,14 +4500,190 @@ static inline void _sdtx_put_char(_sdtx_context_t* ctx, char c) {
     }
 }
 
+/* FNV-1a style hash over 32-bit words (glyph data is always a multiple of 4 bytes) */
+static uint64_t _sdtx_hash(const void* ptr, size_t size) {
+    SOKOL_ASSERT((size & 3) == 0);
+    const uint32_t* words = (const uint32_t*) ptr;
+    const size_t num_words = size / 4;
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < num_words; i++) {
+        h = (h ^ words[i]) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+/*
+    Copy the recorded glyph data into the context's vertex buffer and return
+    the buffer offset. Retained contexts skip the upload if the data is the
+    same as in the last upload.
+*/
+static int _sdtx_upload(_sdtx_context_t* ctx, const sg_range* range) {
+    if (ctx->desc.retained) {
+        const uint64_t hash = _sdtx_hash(range->ptr, range->size);
+        if (ctx->dirty || (hash != ctx->hash) || (range->size != ctx->uploaded_size)) {
+            sg_update_buffer(ctx->vbuf, range);
+            ctx->hash = hash;
+            ctx->uploaded_size = range->size;
+            ctx->dirty = false;
+        }
+        return 0;
+    }
+    else {
+        return sg_append_buffer(ctx->vbuf, range);
+    }
+}
+
+/* render the recorded characters of a context with one instanced draw call per batch */
+static void _sdtx_draw_instances(_sdtx_context_t* ctx) {
+    const int num_instances = (int) (ctx->cur_instance_ptr - ctx->instances);
+    if (num_instances > 0) {
+        sg_push_debug_group("sokol-debugtext");
+        const sg_range range = { ctx->instances, (size_t)num_instances * sizeof(_sdtx_instance_t) };
+        int vbuf_offset = _sdtx_upload(ctx, &range);
+        sg_apply_pipeline(ctx->pip);
+        sg_bindings bindings;
+        memset(&bindings, 0, sizeof(bindings));
+        bindings.vertex_buffers[0] = ctx->vbuf;
+        bindings.vertex_buffers[1] = _sdtx.corner_vbuf;
+        bindings.fs_images[0] = _sdtx.font_img;
+        for (int i = 0; i < ctx->num_batches; i++) {
+            const _sdtx_batch_t* batch = &ctx->batches[i];
+            const int end_instance = ((i + 1) < ctx->num_batches) ? ctx->batches[i + 1].first_instance : num_instances;
+            if (end_instance > batch->first_instance) {
+                /* there's no base-instance in sokol-gfx, so offset the instance buffer instead */
+                bindings.vertex_buffer_offsets[0] = vbuf_offset + batch->first_instance * (int)sizeof(_sdtx_instance_t);
+                sg_apply_bindings(&bindings);
+                const float vs_params[4] = { batch->glyph_size.x, batch->glyph_size.y, 0.0f, 0.0f };
+                const sg_range ub_range = SG_RANGE(vs_params);
+                sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &ub_range);
+                sg_draw(0, 6, end_instance - batch->first_instance);
+            }
+        }
+        sg_pop_debug_group();
+    }
+}
+
+/* return the number of leading characters in str[0..len) which render a glyph (> 32) */
+static int _sdtx_printable_run(const uint8_t* str, int len) {
+    int n = 0;
+    #if defined(_SDTX_SSE2)
+        /* bytes >= 33 are unchanged by max(c, 33) */
+        const __m128i min_chr = _mm_set1_epi8(33);
+        while ((n + 16) <= len) {
+            const __m128i c = _mm_loadu_si128((const __m128i*)(str + n));
+            if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(c, min_chr), c))) {
+                break;
+            }
+            n += 16;
+        }
+    #elif defined(_SDTX_NEON)
+        const uint8x16_t max_ctrl = vdupq_n_u8(32);
+        while ((n + 16) <= len) {
+            const uint8x16_t gt = vcgtq_u8(vld1q_u8(str + n), max_ctrl);
+            uint8x8_t m = vand_u8(vget_low_u8(gt), vget_high_u8(gt));
+            m = vpmin_u8(m, m);
+            m = vpmin_u8(m, m);
+            m = vpmin_u8(m, m);
+            if (0 == vget_lane_u8(m, 0)) {
+                break;
+            }
+            n += 16;
+        }
+    #endif
+    /* remaining bytes, or the 16-byte chunk with the first control character */
+    while ((n < len) && (str[n] > 32)) {
+        n++;
+    }
+    return n;
+}
+
+/* render a run of printable characters, with the capacity check and per-line values hoisted out of the loop */
+static void _sdtx_draw_run(_sdtx_context_t* ctx, const uint8_t* chrs, int num) {
+    const float x = ctx->origin.x + ctx->pos.x;
+    const float y = ctx->origin.y + ctx->pos.y;
+    if (ctx->instanced) {
+        const int avail = (int) (ctx->max_instance_ptr - ctx->cur_instance_ptr);
+        const int n = (num < avail) ? num : avail;
+        const int16_t iy = _sdtx_pack_cell_pos(y);
+        const int16_t font = (int16_t) ctx->cur_font;
+        const uint32_t color = ctx->color;
+        _sdtx_instance_t* inst = ctx->cur_instance_ptr;
+        for (int i = 0; i < n; i++) {
+            inst[i].x = _sdtx_pack_cell_pos(x + (float)i);
+            inst[i].y = iy;
+            inst[i].chr = (int16_t) chrs[i];
+            inst[i].font = font;
+            inst[i].color = color;
+        }
+        ctx->cur_instance_ptr += n;
+        /* characters which didn't fit into the buffer still advance the cursor */
+        ctx->pos.x += (float)num;
+    }
+    else {
+        const int avail = (int) (ctx->max_vertex_ptr - ctx->cur_vertex_ptr) / 6;
+        const int n = (num < avail) ? num : avail;
+        const _sdtx_glyph_t* glyphs = _sdtx.fonts[ctx->cur_font].glyphs;
+        const float gw = ctx->glyph_size.x;
+        const float gh = ctx->glyph_size.y;
+        const uint32_t color = ctx->color;
+        /* running sum of the glyph advances, this keeps the layout O(1) per character for proportional fonts */
+        float adv = 0.0f;
+        _sdtx_vertex_t* vx = ctx->cur_vertex_ptr;
+        for (int i = 0; i < n; i++) {
+            const _sdtx_glyph_t* g = &glyphs[chrs[i]];
+            const float x0 = (x + adv + g->x) * gw;
+            const float y0 = (y + g->y) * gh;
+            const float x1 = x0 + g->w * gw;
+            const float y1 = y0 + g->h * gh;
+            const uint16_t u0 = g->u0;
+            const uint16_t v0 = g->v0;
+            const uint16_t u1 = g->u1;
+            const uint16_t v1 = g->v1;
+            adv += g->advance;
+            vx[0].x=x0; vx[0].y=y0; vx[0].u=u0; vx[0].v=v0; vx[0].color=color;
+            vx[1].x=x1; vx[1].y=y0; vx[1].u=u1; vx[1].v=v0; vx[1].color=color;
+            vx[2].x=x1; vx[2].y=y1; vx[2].u=u1; vx[2].v=v1; vx[2].color=color;
+            vx[3].x=x0; vx[3].y=y0; vx[3].u=u0; vx[3].v=v0; vx[3].color=color;
+            vx[4].x=x1; vx[4].y=y1; vx[4].u=u1; vx[4].v=v1; vx[4].color=color;
+            vx[5].x=x0; vx[5].y=y1; vx[5].u=u0; vx[5].v=v1; vx[5].color=color;
+            vx += 6;
+        }
+        ctx->cur_vertex_ptr = vx;
+        /* characters which didn't fit into the buffer still advance the cursor */
+        for (int i = n; i < num; i++) {
+            adv += glyphs[chrs[i]].advance;
+        }
+        ctx->pos.x += adv;
+    }
+}
+
+/* output a string range without zero characters, split into runs of printable characters */
+static void _sdtx_put_range(_sdtx_context_t* ctx, const char* str, int len) {
+    const uint8_t* ptr = (const uint8_t*) str;
+    int i = 0;
+    while (i < len) {
+        const int run = _sdtx_printable_run(ptr + i, len - i);
+        if (run > 0) {
+            _sdtx_draw_run(ctx, ptr + i, run);
+            i += run;
+        }
+        else {
+            _sdtx_ctrl_char(ctx, ptr[i++]);
+        }
+    }
+}
+
 static sdtx_desc_t _sdtx_desc_defaults(const sdtx_desc_t* in_desc) {
     sdtx_desc_t desc = *in_desc;
     desc.context_pool_size = _sdtx_def(desc.context_pool_size, _SDTX_DEFAULT_CONTEXT_POOL_SIZE);
     desc.printf_buf_size = _sdtx_def(desc.printf_buf_size, _SDTX_DEFAULT_PRINTF_BUF_SIZE);
     for (int i = 0; i < SDTX_MAX_FONTS; i++) {
-        if (desc.fonts[i].data.ptr) {
+        if (desc.fonts[i].data.ptr || desc.fonts[i].atlas.pixels.ptr) {
             desc.fonts[i].last_char = _sdtx_def(desc.fonts[i].last_char, 255);
         }
+        if (desc.fonts[i].atlas.pixels.ptr) {
+            desc.fonts[i].atlas.line_height = _sdtx_def(desc.fonts[i].atlas.line_height, 8);
+        }
     }
     desc.context = _sdtx_context_desc_defaults(&desc.context);
     SOKOL_ASSERT(desc.context_pool_size > 0);
@@ -3880,6 +4692,177 @@ static sdtx_desc_t _sdtx_desc_defaults(const sdtx_desc_t* in_desc) {
     return desc;
 }
 
+static void _sdtx_font(_sdtx_context_t* ctx, int font_index) {
+    ctx->cur_font = font_index;
+}
+
+/* double the size of the batch array (happens only with many sdtx_canvas() calls per frame) */
+static void _sdtx_grow_batches(_sdtx_context_t* ctx) {
+    const int new_max_batches = ctx->max_batches * 2;
+    _sdtx_batch_t* new_batches = (_sdtx_batch_t*) SOKOL_MALLOC((size_t)new_max_batches * sizeof(_sdtx_batch_t));
+    SOKOL_ASSERT(new_batches);
+    memcpy(new_batches, ctx->batches, (size_t)ctx->num_batches * sizeof(_sdtx_batch_t));
+    SOKOL_FREE(ctx->batches);
+    ctx->batches = new_batches;
+    ctx->max_batches = new_max_batches;
+}
+
+static void _sdtx_canvas(_sdtx_context_t* ctx, float w, float h) {
+    ctx->canvas_size.x = w;
+    ctx->canvas_size.y = h;
+    ctx->glyph_size.x = (8.0f / ctx->canvas_size.x);
+    ctx->glyph_size.y = (8.0f / ctx->canvas_size.y);
+    if (ctx->instanced) {
+        /* the glyph size is a shader uniform, start a new batch if characters have
+           been recorded with the old size (or update the last batch if it's still empty)
+        */
+        const int num_instances = (int) (ctx->cur_instance_ptr - ctx->instances);
+        if (num_instances > ctx->batches[ctx->num_batches - 1].first_instance) {
+            if (ctx->num_batches == ctx->max_batches) {
+                _sdtx_grow_batches(ctx);
+            }
+            ctx->batches[ctx->num_batches++].first_instance = num_instances;
+        }
+        ctx->batches[ctx->num_batches - 1].glyph_size = ctx->glyph_size;
+    }
+    ctx->origin.x = 0.0f;
+    ctx->origin.y = 0.0f;
+    ctx->pos.x = 0.0f;
+    ctx->pos.y = 0.0f;
+}
+
+static void _sdtx_origin(_sdtx_context_t* ctx, float x, float y) {
+    ctx->origin.x = x;
+    ctx->origin.y = y;
+}
+
+static void _sdtx_home(_sdtx_context_t* ctx) {
+    ctx->pos.x = 0.0f;
+    ctx->pos.y = 0.0f;
+}
+
+static void _sdtx_pos(_sdtx_context_t* ctx, float x, float y) {
+    ctx->pos.x = x;
+    ctx->pos.y = y;
+}
+
+static void _sdtx_pos_x(_sdtx_context_t* ctx, float x) {
+    ctx->pos.x = x;
+}
+
+static void _sdtx_pos_y(_sdtx_context_t* ctx, float y) {
+    ctx->pos.y = y;
+}
+
+static void _sdtx_move(_sdtx_context_t* ctx, float dx, float dy) {
+    ctx->pos.x += dx;
+    ctx->pos.y += dy;
+}
+
+static void _sdtx_move_x(_sdtx_context_t* ctx, float dx) {
+    ctx->pos.x += dx;
+}
+
+static void _sdtx_move_y(_sdtx_context_t* ctx, float dy) {
+    ctx->pos.y += dy;
+}
+
+static void _sdtx_crlf(_sdtx_context_t* ctx) {
+    ctx->pos.x = 0.0f;
+    ctx->pos.y += _sdtx.fonts[ctx->cur_font].line_height;
+}
+
+static void _sdtx_color3b(_sdtx_context_t* ctx, uint8_t r, uint8_t g, uint8_t b) {
+    ctx->color = _sdtx_pack_rgbab(r, g, b, 255);
+}
+
+static void _sdtx_color3f(_sdtx_context_t* ctx, float r, float g, float b) {
+    ctx->color = _sdtx_pack_rgbaf(r, g, b, 1.0f);
+}
+
+static void _sdtx_color4b(_sdtx_context_t* ctx, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    ctx->color = _sdtx_pack_rgbab(r, g, b, a);
+}
+
+static void _sdtx_color4f(_sdtx_context_t* ctx, float r, float g, float b, float a) {
+    ctx->color = _sdtx_pack_rgbaf(r, g, b, a);
+}
+
+static void _sdtx_color1i(_sdtx_context_t* ctx, uint32_t rgba) {
+    ctx->color = rgba;
+}
+
+static void _sdtx_puts(_sdtx_context_t* ctx, const char* str) {
+    _sdtx_put_range(ctx, str, (int) strlen(str));
+}
+
+static void _sdtx_putr(_sdtx_context_t* ctx, const char* str, int len) {
+    if (len > 0) {
+        /* the range ends at the first zero character */
+        const char* end = (const char*) memchr(str, 0, (size_t)len);
+        if (end) {
+            len = (int) (end - str);
+        }
+        _sdtx_put_range(ctx, str, len);
+    }
+}
+
+/* each context has its own formatting buffer, so that contexts can be filled from different threads */
+static int _sdtx_vprintf(_sdtx_context_t* ctx, const char* fmt, va_list args) {
+    SOKOL_ASSERT(ctx->fmt_buf && (ctx->fmt_buf_size >= 2));
+    int res = SOKOL_VSNPRINTF(ctx->fmt_buf, ctx->fmt_buf_size, fmt, args);
+    // make sure we're 0-terminated in case we're on an old MSVC
+    ctx->fmt_buf[ctx->fmt_buf_size-1] = 0;
+    _sdtx_puts(ctx, ctx->fmt_buf);
+    return res;
+}
+
+static void _sdtx_mark_dirty(_sdtx_context_t* ctx) {
+    ctx->dirty = true;
+}
+
+static void _sdtx_draw(_sdtx_context_t* ctx) {
+    if (ctx->instanced) {
+        _sdtx_draw_instances(ctx);
+    }
+    else {
+        const int num_verts = (int) (ctx->cur_vertex_ptr - ctx->vertices);
+        if (num_verts > 0) {
+            SOKOL_ASSERT((num_verts % 6) == 0);
+            sg_push_debug_group("sokol-debugtext");
+            const sg_range range = { ctx->vertices, (size_t)num_verts * sizeof(_sdtx_vertex_t) };
+            int vbuf_offset = _sdtx_upload(ctx, &range);
+            sg_apply_pipeline(ctx->pip);
+            sg_bindings bindings;
+            memset(&bindings, 0, sizeof(bindings));
+            bindings.vertex_buffers[0] = ctx->vbuf;
+            bindings.vertex_buffer_offsets[0] = vbuf_offset;
+            bindings.fs_images[0] = _sdtx.font_img;
+            sg_apply_bindings(&bindings);
+            sg_draw(0, num_verts, 1);
+            sg_pop_debug_group();
+        }
+    }
+    ctx->cur_vertex_ptr = ctx->vertices;
+    ctx->cur_instance_ptr = ctx->instances;
+    ctx->num_batches = 1;
+    ctx->batches[0].first_instance = 0;
+    ctx->batches[0].glyph_size = ctx->glyph_size;
+    ctx->cur_font = 0;
+    ctx->pos.x = 0.0f;
+    ctx->pos.y = 0.0f;
+}
+
+static sdtx_font_desc_t _sdtx_builtin_font_desc(const uint8_t* data, size_t size) {
+    sdtx_font_desc_t desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.data.ptr = data;
+    desc.data.size = size;
+    desc.first_char = 0;
+    desc.last_char = 255;
+    return desc;
+}
+
 /*=== PUBLIC API FUNCTIONS ===================================================*/
 SOKOL_API_IMPL void sdtx_setup(const sdtx_desc_t* desc) {
     SOKOL_ASSERT(desc);
@@ -3905,33 +4888,27 @@ SOKOL_API_IMPL void sdtx_shutdown(void) {
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_kc853(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_kc853, sizeof(_sdtx_font_kc853) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_kc853, sizeof(_sdtx_font_kc853));
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_kc854(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_kc854, sizeof(_sdtx_font_kc854) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_kc854, sizeof(_sdtx_font_kc854));
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_z1013(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_z1013, sizeof(_sdtx_font_z1013) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_z1013, sizeof(_sdtx_font_z1013));
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_cpc(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_cpc, sizeof(_sdtx_font_cpc) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_cpc, sizeof(_sdtx_font_cpc));
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_c64(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_c64, sizeof(_sdtx_font_c64) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_c64, sizeof(_sdtx_font_c64));
 }
 
 SOKOL_API_IMPL sdtx_font_desc_t sdtx_font_oric(void) {
-    sdtx_font_desc_t desc = { { _sdtx_font_oric, sizeof(_sdtx_font_oric) }, 0, 255 };
-    return desc;
+    return _sdtx_builtin_font_desc(_sdtx_font_oric, sizeof(_sdtx_font_oric));
 }
 
 SOKOL_API_IMPL sdtx_context sdtx_make_context(const sdtx_context_desc_t* desc) {
@@ -3981,7 +4958,16 @@ SOKOL_API_IMPL void sdtx_font(int font_index) {
     SOKOL_ASSERT((font_index >= 0) && (font_index < SDTX_MAX_FONTS));
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->cur_font = font_index;
+        _sdtx_font(ctx, font_index);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_font(sdtx_context ctx_id, int font_index) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    SOKOL_ASSERT((font_index >= 0) && (font_index < SDTX_MAX_FONTS));
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_font(ctx, font_index);
     }
 }
 
@@ -3990,14 +4976,16 @@ SOKOL_API_IMPL void sdtx_canvas(float w, float h) {
     SOKOL_ASSERT((w > 0.0f) && (h > 0.0f));
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->canvas_size.x = w;
-        ctx->canvas_size.y = h;
-        ctx->glyph_size.x = (8.0f / ctx->canvas_size.x);
-        ctx->glyph_size.y = (8.0f / ctx->canvas_size.y);
-        ctx->origin.x = 0.0f;
-        ctx->origin.y = 0.0f;
-        ctx->pos.x = 0.0f;
-        ctx->pos.y = 0.0f;
+        _sdtx_canvas(ctx, w, h);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_canvas(sdtx_context ctx_id, float w, float h) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    SOKOL_ASSERT((w > 0.0f) && (h > 0.0f));
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_canvas(ctx, w, h);
     }
 }
 
@@ -4005,8 +4993,15 @@ SOKOL_API_IMPL void sdtx_origin(float x, float y) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->origin.x = x;
-        ctx->origin.y = y;
+        _sdtx_origin(ctx, x, y);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_origin(sdtx_context ctx_id, float x, float y) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_origin(ctx, x, y);
     }
 }
 
@@ -4014,8 +5009,15 @@ SOKOL_API_IMPL void sdtx_home(void) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x = 0.0f;
-        ctx->pos.y = 0.0f;
+        _sdtx_home(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_home(sdtx_context ctx_id) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_home(ctx);
     }
 }
 
@@ -4023,8 +5025,15 @@ SOKOL_API_IMPL void sdtx_pos(float x, float y) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x = x;
-        ctx->pos.y = y;
+        _sdtx_pos(ctx, x, y);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_pos(sdtx_context ctx_id, float x, float y) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_pos(ctx, x, y);
     }
 }
 
@@ -4032,7 +5041,15 @@ SOKOL_API_IMPL void sdtx_pos_x(float x) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x = x;
+        _sdtx_pos_x(ctx, x);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_pos_x(sdtx_context ctx_id, float x) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_pos_x(ctx, x);
     }
 }
 
@@ -4040,7 +5057,15 @@ SOKOL_API_IMPL void sdtx_pos_y(float y) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.y = y;
+        _sdtx_pos_y(ctx, y);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_pos_y(sdtx_context ctx_id, float y) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_pos_y(ctx, y);
     }
 }
 
@@ -4048,8 +5073,15 @@ SOKOL_API_IMPL void sdtx_move(float dx, float dy) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x += dx;
-        ctx->pos.y += dy;
+        _sdtx_move(ctx, dx, dy);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_move(sdtx_context ctx_id, float dx, float dy) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_move(ctx, dx, dy);
     }
 }
 
@@ -4057,7 +5089,15 @@ SOKOL_API_IMPL void sdtx_move_x(float dx) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x += dx;
+        _sdtx_move_x(ctx, dx);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_move_x(sdtx_context ctx_id, float dx) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_move_x(ctx, dx);
     }
 }
 
@@ -4065,7 +5105,15 @@ SOKOL_API_IMPL void sdtx_move_y(float dy) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.y += dy;
+        _sdtx_move_y(ctx, dy);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_move_y(sdtx_context ctx_id, float dy) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_move_y(ctx, dy);
     }
 }
 
@@ -4073,8 +5121,15 @@ SOKOL_API_IMPL void sdtx_crlf(void) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->pos.x = 0.0f;
-        ctx->pos.y += 1.0f;
+        _sdtx_crlf(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_crlf(sdtx_context ctx_id) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_crlf(ctx);
     }
 }
 
@@ -4082,7 +5137,15 @@ SOKOL_API_IMPL void sdtx_color3b(uint8_t r, uint8_t g, uint8_t b) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->color = _sdtx_pack_rgbab(r, g, b, 255);
+        _sdtx_color3b(ctx, r, g, b);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_color3b(sdtx_context ctx_id, uint8_t r, uint8_t g, uint8_t b) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_color3b(ctx, r, g, b);
     }
 }
 
@@ -4090,7 +5153,15 @@ SOKOL_API_IMPL void sdtx_color3f(float r, float g, float b) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->color = _sdtx_pack_rgbaf(r, g, b, 1.0f);
+        _sdtx_color3f(ctx, r, g, b);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_color3f(sdtx_context ctx_id, float r, float g, float b) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_color3f(ctx, r, g, b);
     }
 }
 
@@ -4098,7 +5169,15 @@ SOKOL_API_IMPL void sdtx_color4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->color = _sdtx_pack_rgbab(r, g, b, a);
+        _sdtx_color4b(ctx, r, g, b, a);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_color4b(sdtx_context ctx_id, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_color4b(ctx, r, g, b, a);
     }
 }
 
@@ -4106,7 +5185,15 @@ SOKOL_API_IMPL void sdtx_color4f(float r, float g, float b, float a) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->color = _sdtx_pack_rgbaf(r, g, b, a);
+        _sdtx_color4f(ctx, r, g, b, a);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_color4f(sdtx_context ctx_id, float r, float g, float b, float a) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_color4f(ctx, r, g, b, a);
     }
 }
 
@@ -4114,7 +5201,15 @@ SOKOL_API_IMPL void sdtx_color1i(uint32_t rgba) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        ctx->color = rgba;
+        _sdtx_color1i(ctx, rgba);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_color1i(sdtx_context ctx_id, uint32_t rgba) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_color1i(ctx, rgba);
     }
 }
 
@@ -4126,14 +5221,27 @@ SOKOL_DEBUGTEXT_API_DECL void sdtx_putc(char chr) {
     }
 }
 
+SOKOL_API_IMPL void sdtx_context_putc(sdtx_context ctx_id, char chr) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_put_char(ctx, chr);
+    }
+}
+
 SOKOL_DEBUGTEXT_API_DECL void sdtx_puts(const char* str) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        char chr;
-        while (0 != (chr = *str++)) {
-            _sdtx_put_char(ctx, chr);
-        }
+        _sdtx_puts(ctx, str);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_puts(sdtx_context ctx_id, const char* str) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_puts(ctx, str);
     }
 }
 
@@ -4141,63 +5249,83 @@ SOKOL_DEBUGTEXT_API_DECL void sdtx_putr(const char* str, int len) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        for (int i = 0; i < len; i++) {
-            char chr = str[i];
-            if (0 == chr) {
-                break;
-            }
-            _sdtx_put_char(ctx, chr);
-        }
+        _sdtx_putr(ctx, str, len);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_putr(sdtx_context ctx_id, const char* str, int len) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_putr(ctx, str, len);
     }
 }
 
 SOKOL_DEBUGTEXT_API_DECL int sdtx_vprintf(const char* fmt, va_list args) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
-    SOKOL_ASSERT(_sdtx.fmt_buf && (_sdtx.fmt_buf_size >= 2));
-    int res = SOKOL_VSNPRINTF(_sdtx.fmt_buf, _sdtx.fmt_buf_size, fmt, args);
-    // make sure we're 0-terminated in case we're on an old MSVC
-    _sdtx.fmt_buf[_sdtx.fmt_buf_size-1] = 0;
-    sdtx_puts(_sdtx.fmt_buf);
-    return res;
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        return _sdtx_vprintf(ctx, fmt, args);
+    }
+    return 0;
+}
+
+SOKOL_API_IMPL int sdtx_context_vprintf(sdtx_context ctx_id, const char* fmt, va_list args) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        return _sdtx_vprintf(ctx, fmt, args);
+    }
+    return 0;
 }
 
 SOKOL_DEBUGTEXT_API_DECL int sdtx_printf(const char* fmt, ...) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
-    SOKOL_ASSERT(_sdtx.fmt_buf && (_sdtx.fmt_buf_size >= 2));
     va_list args;
     va_start(args, fmt);
-    int res = SOKOL_VSNPRINTF(_sdtx.fmt_buf, _sdtx.fmt_buf_size, fmt, args);
+    int res = sdtx_vprintf(fmt, args);
     va_end(args);
-    // make sure we're 0-terminated in case we're on an old MSVC
-    _sdtx.fmt_buf[_sdtx.fmt_buf_size-1] = 0;
-    sdtx_puts(_sdtx.fmt_buf);
     return res;
 }
 
+SOKOL_API_IMPL int sdtx_context_printf(sdtx_context ctx_id, const char* fmt, ...) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    va_list args;
+    va_start(args, fmt);
+    int res = sdtx_context_vprintf(ctx_id, fmt, args);
+    va_end(args);
+    return res;
+}
+
+SOKOL_API_IMPL void sdtx_mark_dirty(void) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        _sdtx_mark_dirty(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_mark_dirty(sdtx_context ctx_id) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_mark_dirty(ctx);
+    }
+}
+
 SOKOL_API_IMPL void sdtx_draw(void) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     _sdtx_context_t* ctx = _sdtx.cur_ctx;
     if (ctx) {
-        const int num_verts = (int) (ctx->cur_vertex_ptr - ctx->vertices);
-        if (num_verts > 0) {
-            SOKOL_ASSERT((num_verts % 6) == 0);
-            sg_push_debug_group("sokol-debugtext");
-            const sg_range range = { ctx->vertices, (size_t)num_verts * sizeof(_sdtx_vertex_t) };
-            int vbuf_offset = sg_append_buffer(ctx->vbuf, &range);
-            sg_apply_pipeline(ctx->pip);
-            sg_bindings bindings;
-            memset(&bindings, 0, sizeof(bindings));
-            bindings.vertex_buffers[0] = ctx->vbuf;
-            bindings.vertex_buffer_offsets[0] = vbuf_offset;
-            bindings.fs_images[0] = _sdtx.font_img;
-            sg_apply_bindings(&bindings);
-            sg_draw(0, num_verts, 1);
-            sg_pop_debug_group();
-        }
-        ctx->cur_vertex_ptr = ctx->vertices;
-        ctx->cur_font = 0;
-        ctx->pos.x = 0.0f;
-        ctx->pos.y = 0.0f;
+        _sdtx_draw(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_draw(sdtx_context ctx_id) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_draw(ctx);
     }
 }
 
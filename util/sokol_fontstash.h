@@ -60,6 +60,14 @@
         Each FONScontext manages one font atlas texture which can hold rasterized
         glyphs for multiple fonts.
 
+        To recycle atlas space of glyphs which haven't been rendered
+        recently instead of failing to render new glyphs once the atlas
+        is full, add the flag SFONS_EVICT_GLYPHS:
+
+            FONScontext* ctx = sfons_create(w, h, FONS_ZERO_TOPLEFT|SFONS_EVICT_GLYPHS);
+
+        See ATLAS EVICTION below for details.
+
     --- From here on, use fontstash.h's functions "as usual" to add TTF
         font data and draw text. Note that (just like with sokol-gl), text
         rendering can happen anywhere in the frame, not only inside
@@ -77,7 +85,9 @@
             sfons_flush(FONScontext* ctx)
 
         ...this will update the dynamic sokol-gfx texture with the latest font
-        atlas content.
+        atlas content (only the area which contains new glyphs is uploaded,
+        and since this uses sg_update_image_region(), sfons_flush() may
+        also be called more than once per frame).
 
     --- To actually render the text (and any other sokol-gl draw commands),
         call sgl_draw() inside a sokol-gfx frame.
@@ -111,8 +121,8 @@
             sgl_push_pipeline();
             sgl_load_pipeline(...);
             sgl_begin_triangles();
-            for each vertex:
-                sg_v2f_t2f_c1i(...);
+            sgl_reserve(num_vertices);
+            ...write all vertices into the reserved space...
             sgl_end();
             sgl_pop_pipeline();
             sgl_disable_texture();
@@ -123,13 +133,62 @@
           as long as all calls use the same FONScontext
 
     sfons_flush():
-        - this will call sg_update_image() on the font atlas texture
-          if fontstash.h has added any rasterized glyphs since the last
-          frame
+        - if fontstash.h has added any rasterized glyphs since the last
+          call, this will call sg_update_image_region() on the font atlas
+          texture with the smallest rectangle containing all updated atlas
+          areas (instead of uploading the entire atlas)
+        - with SFONS_EVICT_GLYPHS, starts a new frame for tracking
+          which atlas pages are in use (see ATLAS EVICTION)
 
     sfons_shutdown():
         - destroy the font atlas texture, sgl_pipeline and sg_shader objects
 
+    ATLAS EVICTION
+    ==============
+    By default, fontstash.h fails to render new glyphs once the font atlas
+    is full (it calls the error callback installed with fonsSetErrorCallback()
+    with FONS_ATLAS_FULL, the application can then for instance call
+    fonsExpandAtlas() or fonsResetAtlas()).
+
+    When sfons_create() is called with the SFONS_EVICT_GLYPHS flag,
+    sokol_fontstash.h installs its own error callback instead, which
+    recycles atlas space in place:
+
+        - the atlas is split into 4 vertical pages of equal width, new
+          glyphs are packed into one page at a time, starting with the
+          first page
+        - sokol_fontstash.h keeps track of the last frame each page was
+          sampled by rendered text
+        - when a new glyph doesn't fit into the atlas, the least recently
+          used page which isn't used in the current frame is evicted:
+          only the glyphs in that page are removed from fontstash.h's glyph
+          cache, and new glyphs are packed into this page until it is full
+        - evicted glyphs are rasterized again when they are rendered the
+          next time, glyphs in the other pages are not affected
+        - the atlas texture is neither re-created nor uploaded in its
+          entirety, only newly rasterized glyphs are uploaded as usual
+
+    If all pages are in use in the current frame, the new glyph is not
+    rendered, so the atlas should be big enough to hold all glyphs of one
+    frame, and a single glyph must fit into one page (a quarter of the atlas
+    width).
+
+    Some notes:
+
+        - glyph eviction requires a fontstash.h version with support for
+          FONS_GLYPH_BITMAP_REQUIRED (glyphs without a rasterized bitmap)
+        - sfons_flush() must be called exactly once per frame, since this
+          marks the start of a new frame for page tracking
+        - quads obtained via fonsTextIterNext() and rendered by the
+          application are not tracked, only text rendered via fonsDrawText()
+        - don't install another error callback with fonsSetErrorCallback(),
+          this would disable glyph eviction
+        - fonsResetAtlas() and fonsExpandAtlas() can still be called,
+          but until the next sfons_flush() new glyphs may be packed
+          anywhere in the atlas (such glyphs are evicted together with
+          every page they overlap), sfons_flush() then restricts packing
+          to the active page again
+
     LICENSE
     =======
     zlib/libpng license
@@ -179,6 +238,11 @@
 extern "C" {
 #endif
 
+/* additional flag for sfons_create(), evict glyphs when the atlas is full */
+enum {
+    SFONS_EVICT_GLYPHS = (1<<7)
+};
+
 SOKOL_FONTSTASH_API_DECL FONScontext* sfons_create(int width, int height, int flags);
 SOKOL_FONTSTASH_API_DECL void sfons_destroy(FONScontext* ctx);
 SOKOL_FONTSTASH_API_DECL void sfons_flush(FONScontext* ctx);
@@ -1579,14 +1643,45 @@ static const char* _sfons_fs_source_dummy = "";
 #error "Please define one of SOKOL_GLCORE33, SOKOL_GLES2, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU or SOKOL_DUMMY_BACKEND!"
 #endif
 
+#define _SFONS_NUM_ATLAS_PAGES (4)
+
 typedef struct _sfons_t {
     sg_shader shd;
     sgl_pipeline pip;
     sg_image img;
     int width, height;
     bool img_dirty;
+    int dirty_rect[4];      /* union of the atlas areas updated since the last sfons_flush(): x0, y0, x1, y1 */
+    /* glyph eviction (SFONS_EVICT_GLYPHS) */
+    FONScontext* ctx;
+    bool evict_glyphs;
+    uint32_t frame_index;   /* incremented in sfons_flush() */
+    uint32_t page_frame_index[_SFONS_NUM_ATLAS_PAGES];  /* frame index at which an atlas page was last used */
+    int active_page;        /* the page new glyphs are packed into */
+    bool atlas_reset;       /* fonsResetAtlas() or fonsExpandAtlas() was called, restrict packing again in sfons_flush() */
 } _sfons_t;
 
+/* atlas pages are vertical stripes, the last page also gets the remaining pixels */
+static int _sfons_atlas_page(const _sfons_t* sfons, int x) {
+    const int page = x / (sfons->width / _SFONS_NUM_ATLAS_PAGES);
+    if (page < 0) {
+        return 0;
+    }
+    else if (page >= _SFONS_NUM_ATLAS_PAGES) {
+        return _SFONS_NUM_ATLAS_PAGES - 1;
+    }
+    else {
+        return page;
+    }
+}
+
+static void _sfons_use_atlas_pages(_sfons_t* sfons, const float* tcoords, int nverts) {
+    for (int i = 0; i < nverts; i++) {
+        const int page = _sfons_atlas_page(sfons, (int) (tcoords[2*i] * (float)sfons->width));
+        sfons->page_frame_index[page] = sfons->frame_index;
+    }
+}
+
 static int _sfons_render_create(void* user_ptr, int width, int height) {
     SOKOL_ASSERT(user_ptr && (width > 8) && (height > 8));
     _sfons_t* sfons = (_sfons_t*) user_ptr;
@@ -1645,8 +1740,8 @@ static int _sfons_render_create(void* user_ptr, int width, int height) {
             shd_desc.fs.byte_code = _sfons_fs_bytecode_wgpu;
             shd_desc.fs.byte_code_size = sizeof(_sfons_fs_bytecode_wgpu);
         #else
-            shd_desc.vs.source = _sfons_vs_src_dummy;
-            shd_desc.fs.source = _sfons_fs_src_dummy;
+            shd_desc.vs.source = _sfons_vs_source_dummy;
+            shd_desc.fs.source = _sfons_fs_source_dummy;
         #endif
         shd_desc.label = "sfons-shader";
         sfons->shd = sg_make_shader(&shd_desc);
@@ -1667,6 +1762,10 @@ static int _sfons_render_create(void* user_ptr, int width, int height) {
     if (sfons->img.id != SG_INVALID_ID) {
         sg_destroy_image(sfons->img);
         sfons->img.id = SG_INVALID_ID;
+        /* the page layout changes with the atlas size, don't evict anything in this frame */
+        for (int i = 0; i < _SFONS_NUM_ATLAS_PAGES; i++) {
+            sfons->page_frame_index[i] = sfons->frame_index;
+        }
     }
     sfons->width = width;
     sfons->height = height;
@@ -1679,39 +1778,196 @@ static int _sfons_render_create(void* user_ptr, int width, int height) {
     img_desc.min_filter = SG_FILTER_LINEAR;
     img_desc.mag_filter = SG_FILTER_LINEAR;
     img_desc.usage = SG_USAGE_DYNAMIC;
+    img_desc.region_updates = true;
     img_desc.pixel_format = SG_PIXELFORMAT_R8;
     sfons->img = sg_make_image(&img_desc);
+
+    /* the new texture has undefined content, upload the entire atlas in the next sfons_flush() */
+    sfons->img_dirty = true;
+    sfons->dirty_rect[0] = 0;
+    sfons->dirty_rect[1] = 0;
+    sfons->dirty_rect[2] = width;
+    sfons->dirty_rect[3] = height;
     return 1;
 }
 
 static int _sfons_render_resize(void* user_ptr, int width, int height) {
+    SOKOL_ASSERT(user_ptr);
+    _sfons_t* sfons = (_sfons_t*) user_ptr;
+    /* fontstash.h resets or grows the atlas skyline after this callback returns */
+    sfons->atlas_reset = sfons->evict_glyphs;
+    if ((sfons->img.id != SG_INVALID_ID) && (width == sfons->width) && (height == sfons->height)) {
+        /* atlas reset with unchanged size: keep the texture, it will be
+           overwritten with the cleared atlas content in the next sfons_flush()
+        */
+        sfons->img_dirty = true;
+        sfons->dirty_rect[0] = 0;
+        sfons->dirty_rect[1] = 0;
+        sfons->dirty_rect[2] = width;
+        sfons->dirty_rect[3] = height;
+        return 1;
+    }
     return _sfons_render_create(user_ptr, width, height);
 }
 
 static void _sfons_render_update(void* user_ptr, int* rect, const unsigned char* data) {
     SOKOL_ASSERT(user_ptr && rect && data);
-    _SOKOL_UNUSED(rect);
     _SOKOL_UNUSED(data);
     _sfons_t* sfons = (_sfons_t*) user_ptr;
-    sfons->img_dirty = true;
+    if ((rect[0] >= rect[2]) || (rect[1] >= rect[3])) {
+        return;
+    }
+    if (sfons->img_dirty) {
+        /* grow the dirty rectangle to include the new area */
+        if (rect[0] < sfons->dirty_rect[0]) { sfons->dirty_rect[0] = rect[0]; }
+        if (rect[1] < sfons->dirty_rect[1]) { sfons->dirty_rect[1] = rect[1]; }
+        if (rect[2] > sfons->dirty_rect[2]) { sfons->dirty_rect[2] = rect[2]; }
+        if (rect[3] > sfons->dirty_rect[3]) { sfons->dirty_rect[3] = rect[3]; }
+    }
+    else {
+        sfons->img_dirty = true;
+        for (int i = 0; i < 4; i++) {
+            sfons->dirty_rect[i] = rect[i];
+        }
+    }
 }
 
 static void _sfons_render_draw(void* user_ptr, const float* verts, const float* tcoords, const unsigned int* colors, int nverts) {
     SOKOL_ASSERT(user_ptr && verts && tcoords && colors && (nverts > 0));
     _sfons_t* sfons = (_sfons_t*) user_ptr;
+    if (sfons->evict_glyphs) {
+        _sfons_use_atlas_pages(sfons, tcoords, nverts);
+    }
     sgl_enable_texture();
     sgl_texture(sfons->img);
     sgl_push_pipeline();
     sgl_load_pipeline(sfons->pip);
     sgl_begin_triangles();
-    for (int i = 0; i < nverts; i++) {
-        sgl_v2f_t2f_c1i(verts[2*i+0], verts[2*i+1], tcoords[2*i+0], tcoords[2*i+1], colors[i]);
+    /* write the vertices directly into sokol-gl's vertex buffer (fontstash's colors are already packed as 0xAABBGGRR) */
+    sgl_vertex_t* vtx = sgl_reserve(nverts);
+    if (vtx) {
+        for (int i = 0; i < nverts; i++) {
+            vtx[i].pos[0] = verts[2*i+0];
+            vtx[i].pos[1] = verts[2*i+1];
+            vtx[i].pos[2] = 0.0f;
+            vtx[i].uv[0] = tcoords[2*i+0];
+            vtx[i].uv[1] = tcoords[2*i+1];
+            vtx[i].rgba = colors[i];
+        }
     }
     sgl_end();
     sgl_pop_pipeline();
     sgl_disable_texture();
 }
 
+static void _sfons_atlas_page_range(const _sfons_t* sfons, int page, int* x0, int* x1) {
+    const int page_width = sfons->width / _SFONS_NUM_ATLAS_PAGES;
+    *x0 = page * page_width;
+    *x1 = (page == (_SFONS_NUM_ATLAS_PAGES - 1)) ? sfons->width : (*x0 + page_width);
+}
+
+/* clip the atlas skyline to the active page, all other pages appear full */
+static void _sfons_restrict_atlas_page(_sfons_t* sfons) {
+    FONSatlas* atlas = sfons->ctx->atlas;
+    int x0, x1;
+    _sfons_atlas_page_range(sfons, sfons->active_page, &x0, &x1);
+    int num_nodes = 0;
+    for (int i = 0; i < atlas->nnodes; i++) {
+        const FONSatlasNode node = atlas->nodes[i];
+        const int node_x0 = (node.x > x0) ? node.x : x0;
+        const int node_x1 = ((node.x + node.width) < x1) ? (node.x + node.width) : x1;
+        if (node_x1 > node_x0) {
+            atlas->nodes[num_nodes].x = (short) node_x0;
+            atlas->nodes[num_nodes].y = node.y;
+            atlas->nodes[num_nodes].width = (short) (node_x1 - node_x0);
+            num_nodes++;
+        }
+    }
+    atlas->nnodes = num_nodes;
+    if (x0 > 0) {
+        fons__atlasInsertNode(atlas, 0, 0, atlas->height, x0);
+    }
+    if (x1 < atlas->width) {
+        fons__atlasInsertNode(atlas, atlas->nnodes, x1, atlas->height, atlas->width - x1);
+    }
+}
+
+/* evict the least recently used atlas page which isn't used in the current frame */
+static void _sfons_evict_atlas_page(_sfons_t* sfons) {
+    FONScontext* ctx = sfons->ctx;
+    SOKOL_ASSERT(ctx);
+    /* vertices which haven't been passed to sokol-gl yet also reference atlas pages */
+    _sfons_use_atlas_pages(sfons, ctx->tcoords, ctx->nverts);
+    int page = -1;
+    for (int i = 0; i < _SFONS_NUM_ATLAS_PAGES; i++) {
+        if (sfons->page_frame_index[i] != sfons->frame_index) {
+            if ((page == -1) || (sfons->page_frame_index[i] < sfons->page_frame_index[page])) {
+                page = i;
+            }
+        }
+    }
+    if (page == -1) {
+        /* all pages are in use, the new glyph will be dropped */
+        return;
+    }
+    int x0, x1;
+    _sfons_atlas_page_range(sfons, page, &x0, &x1);
+
+    /* remove the bitmaps of all glyphs overlapping the page (glyphs packed
+       after fonsResetAtlas() or fonsExpandAtlas() may straddle two pages),
+       but keep the glyphs themselves in the glyph cache (existing glyph
+       pointers must remain valid), fontstash.h will rasterize them again
+       on their next use
+    */
+    for (int font_index = 0; font_index < ctx->nfonts; font_index++) {
+        FONSfont* font = ctx->fonts[font_index];
+        for (int glyph_index = 0; glyph_index < font->nglyphs; glyph_index++) {
+            FONSglyph* glyph = &font->glyphs[glyph_index];
+            if ((glyph->x0 >= 0) && (glyph->x0 < x1) && (glyph->x1 > x0)) {
+                glyph->x1 = (short) (glyph->x1 - glyph->x0 - 1);
+                glyph->y1 = (short) (glyph->y1 - glyph->y0 - 1);
+                glyph->x0 = -1;
+                glyph->y0 = -1;
+            }
+        }
+    }
+
+    /* clear the page's texels: fontstash.h only clears the outermost
+       border of a new glyph's rectangle, but the padding between this
+       border and the glyph bitmap is sampled by the glyph quads and
+       read by fons__blur(), so stale pixels of the evicted glyphs would
+       show up as edge artifacts (no need to mark the page as dirty,
+       only the new glyph rectangles are uploaded)
+    */
+    const int stride = ctx->params.width;
+    for (int y = 0; y < ctx->params.height; y++) {
+        memset(ctx->texData + y * stride + x0, 0, (size_t) (x1 - x0));
+    }
+
+    /* reset the atlas skyline so that new glyphs are only packed into
+       the evicted page
+    */
+    FONSatlas* atlas = ctx->atlas;
+    atlas->nnodes = 0;
+    fons__atlasInsertNode(atlas, 0, 0, 0, atlas->width);
+    sfons->active_page = page;
+    _sfons_restrict_atlas_page(sfons);
+    if (x0 == 0) {
+        /* restore the white rect used by fonsDrawDebug() */
+        fons__addWhiteRect(ctx, 2, 2);
+    }
+    sfons->page_frame_index[page] = sfons->frame_index;
+}
+
+static void _sfons_error_callback(void* user_ptr, int error, int val) {
+    SOKOL_ASSERT(user_ptr);
+    _SOKOL_UNUSED(val);
+    _sfons_t* sfons = (_sfons_t*) user_ptr;
+    if (error == FONS_ATLAS_FULL) {
+        _sfons_evict_atlas_page(sfons);
+    }
+}
+
 static void _sfons_render_delete(void* user_ptr) {
     SOKOL_ASSERT(user_ptr);
     _sfons_t* sfons = (_sfons_t*) user_ptr;
@@ -1745,10 +2001,12 @@ SOKOL_API_IMPL FONScontext* sfons_create(int width, int height, int flags) {
     FONSparams params;
     _sfons_t* sfons = (_sfons_t*) SOKOL_MALLOC(sizeof(_sfons_t));
     memset(sfons, 0, sizeof(_sfons_t));
+    sfons->evict_glyphs = 0 != (flags & SFONS_EVICT_GLYPHS);
+    sfons->frame_index = 1;
     memset(&params, 0, sizeof(params));
     params.width = width;
     params.height = height;
-    params.flags = (unsigned char) flags;
+    params.flags = (unsigned char) (flags & ~SFONS_EVICT_GLYPHS);
     params.renderCreate = _sfons_render_create;
     params.renderResize = _sfons_render_resize;
     params.renderUpdate = _sfons_render_update;
@@ -1756,6 +2014,14 @@ SOKOL_API_IMPL FONScontext* sfons_create(int width, int height, int flags) {
     params.renderDelete = _sfons_render_delete;
     params.userPtr = sfons;
     FONScontext* ctx = fonsCreateInternal(&params);
+    if (ctx && sfons->evict_glyphs) {
+        sfons->ctx = ctx;
+        fonsSetErrorCallback(ctx, _sfons_error_callback, sfons);
+        /* start packing glyphs into the first page only, otherwise the
+           first glyphs would be spread over all pages
+        */
+        _sfons_evict_atlas_page(sfons);
+    }
     _SFONS_CLANG_ANALYZER_SILENCE_POTENTIAL_LEAK_FALSE_POSITIVE(sfons);
     return ctx;
 }
@@ -1770,12 +2036,28 @@ SOKOL_API_IMPL void sfons_flush(FONScontext* ctx) {
     _sfons_t* sfons = (_sfons_t*) ctx->params.userPtr;
     if (sfons->img_dirty) {
         sfons->img_dirty = false;
-        sg_image_data data;
-        memset(&data, 0, sizeof(data));
-        data.subimage[0][0].ptr = ctx->texData;
-        data.subimage[0][0].size = (size_t) (sfons->width * sfons->height);
-        sg_update_image(sfons->img, &data);
+        /* only upload the rectangle which contains all atlas updates since the last flush */
+        const int x0 = (sfons->dirty_rect[0] > 0) ? sfons->dirty_rect[0] : 0;
+        const int y0 = (sfons->dirty_rect[1] > 0) ? sfons->dirty_rect[1] : 0;
+        const int x1 = (sfons->dirty_rect[2] < sfons->width) ? sfons->dirty_rect[2] : sfons->width;
+        const int y1 = (sfons->dirty_rect[3] < sfons->height) ? sfons->dirty_rect[3] : sfons->height;
+        if ((x1 > x0) && (y1 > y0)) {
+            const int w = x1 - x0;
+            const int h = y1 - y0;
+            sg_range data;
+            data.ptr = ctx->texData + y0 * sfons->width + x0;
+            data.size = (size_t) ((h - 1) * sfons->width + w);
+            sg_update_image_region(sfons->img, 0, 0, x0, y0, w, h, &data, sfons->width);
+        }
+    }
+    if (sfons->atlas_reset) {
+        /* glyphs may have been packed across page boundaries since the
+           reset, those are evicted together with the pages they overlap
+        */
+        sfons->atlas_reset = false;
+        _sfons_restrict_atlas_page(sfons);
     }
+    sfons->frame_index++;
 }
 
 SOKOL_API_IMPL uint32_t sfons_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
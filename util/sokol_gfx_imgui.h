@@ -287,6 +287,7 @@ typedef enum {
     SG_IMGUI_CMD_DESTROY_PASS,
     SG_IMGUI_CMD_UPDATE_BUFFER,
     SG_IMGUI_CMD_UPDATE_IMAGE,
+    SG_IMGUI_CMD_UPDATE_IMAGE_REGION,
     SG_IMGUI_CMD_APPEND_BUFFER,
     SG_IMGUI_CMD_BEGIN_DEFAULT_PASS,
     SG_IMGUI_CMD_BEGIN_PASS,
@@ -385,6 +386,13 @@ typedef struct {
     sg_image image;
 } sg_imgui_args_update_image_t;
 
+typedef struct {
+    sg_image image;
+    int mip_level;
+    int slice;
+    int x, y, width, height;
+} sg_imgui_args_update_image_region_t;
+
 typedef struct {
     sg_buffer buffer;
     size_t data_size;
@@ -551,6 +559,7 @@ typedef union {
     sg_imgui_args_destroy_pass_t destroy_pass;
     sg_imgui_args_update_buffer_t update_buffer;
     sg_imgui_args_update_image_t update_image;
+    sg_imgui_args_update_image_region_t update_image_region;
     sg_imgui_args_append_buffer_t append_buffer;
     sg_imgui_args_begin_default_pass_t begin_default_pass;
     sg_imgui_args_begin_pass_t begin_pass;
@@ -1607,6 +1616,15 @@ _SOKOL_PRIVATE sg_imgui_str_t _sg_imgui_capture_item_string(sg_imgui_t* ctx, int
             }
             break;
 
+        case SG_IMGUI_CMD_UPDATE_IMAGE_REGION:
+            {
+                const sg_imgui_args_update_image_region_t* args = &item->args.update_image_region;
+                sg_imgui_str_t res_id = _sg_imgui_image_id_string(ctx, args->image);
+                _sg_imgui_snprintf(&str, "%d: sg_update_image_region(img=%s, mip=%d, slice=%d, x=%d, y=%d, w=%d, h=%d, data=..)",
+                    index, res_id.buf, args->mip_level, args->slice, args->x, args->y, args->width, args->height);
+            }
+            break;
+
         case SG_IMGUI_CMD_APPEND_BUFFER:
             {
                 sg_imgui_str_t res_id = _sg_imgui_buffer_id_string(ctx, item->args.append_buffer.buffer);
@@ -2126,6 +2144,26 @@ _SOKOL_PRIVATE void _sg_imgui_update_image(sg_image img, const sg_image_data* da
     }
 }
 
+_SOKOL_PRIVATE void _sg_imgui_update_image_region(sg_image img, int mip_level, int slice, int x, int y, int width, int height, const sg_range* data, int row_pitch, void* user_data) {
+    sg_imgui_t* ctx = (sg_imgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    sg_imgui_capture_item_t* item = _sg_imgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = SG_IMGUI_CMD_UPDATE_IMAGE_REGION;
+        item->color = _SG_IMGUI_COLOR_RSRC;
+        item->args.update_image_region.image = img;
+        item->args.update_image_region.mip_level = mip_level;
+        item->args.update_image_region.slice = slice;
+        item->args.update_image_region.x = x;
+        item->args.update_image_region.y = y;
+        item->args.update_image_region.width = width;
+        item->args.update_image_region.height = height;
+    }
+    if (ctx->hooks.update_image_region) {
+        ctx->hooks.update_image_region(img, mip_level, slice, x, y, width, height, data, row_pitch, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_imgui_append_buffer(sg_buffer buf, const sg_range* data, int result, void* user_data) {
     sg_imgui_t* ctx = (sg_imgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3084,6 +3122,7 @@ _SOKOL_PRIVATE void _sg_imgui_draw_image_panel(sg_imgui_t* ctx, sg_image img) {
             igSeparator();
             igText("Type:              %s", _sg_imgui_imagetype_string(desc->type));
             igText("Usage:             %s", _sg_imgui_usage_string(desc->usage));
+            igText("Region Updates:    %s", _sg_imgui_bool_string(desc->region_updates));
             igText("Render Target:     %s", _sg_imgui_bool_string(desc->render_target));
             igText("Width:             %d", desc->width);
             igText("Height:            %d", desc->height);
@@ -3630,6 +3669,9 @@ _SOKOL_PRIVATE void _sg_imgui_draw_capture_panel(sg_imgui_t* ctx) {
         case SG_IMGUI_CMD_UPDATE_IMAGE:
             _sg_imgui_draw_image_panel(ctx, item->args.update_image.image);
             break;
+        case SG_IMGUI_CMD_UPDATE_IMAGE_REGION:
+            _sg_imgui_draw_image_panel(ctx, item->args.update_image_region.image);
+            break;
         case SG_IMGUI_CMD_APPEND_BUFFER:
             _sg_imgui_draw_buffer_panel(ctx, item->args.update_buffer.buffer);
             break;
@@ -3773,6 +3815,7 @@ SOKOL_API_IMPL void sg_imgui_init(sg_imgui_t* ctx) {
     hooks.destroy_pass = _sg_imgui_destroy_pass;
     hooks.update_buffer = _sg_imgui_update_buffer;
     hooks.update_image = _sg_imgui_update_image;
+    hooks.update_image_region = _sg_imgui_update_image_region;
     hooks.append_buffer = _sg_imgui_append_buffer;
     hooks.begin_default_pass = _sg_imgui_begin_default_pass;
     hooks.begin_pass = _sg_imgui_begin_pass;
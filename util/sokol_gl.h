@@ -34,6 +34,7 @@
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
     SOKOL_LOG(msg)      - your own logging function (default: puts(msg))
     SOKOL_UNREACHABLE() - a guard macro for unreachable code (default: assert(false))
+    SGL_NO_SIMD         - don't use SSE2/NEON code paths for the CPU-side matrix and vertex math
 
     If sokol_gl.h is compiled as a DLL, define the following before
     including the declaration or implementation:
@@ -76,8 +77,8 @@
 
     Notable GLES 1.x features that are *NOT* implemented:
         - vertex lighting (this is the most likely GL feature that might be added later)
-        - vertex arrays (although providing whole chunks of vertex data at once
-          might be a useful feature for a later version)
+        - vertex arrays (but whole chunks of vertex data can be provided at
+          once with sgl_vertices() and sgl_reserve())
         - texture coordinate generation
         - point size and line width
         - all pixel store functions
@@ -121,11 +122,25 @@
             int max_vertices    - default is 65536
             int max_commands    - default is 16384
 
+        NOTE: quads are rendered with an index buffer, if max_vertices
+        is greater than 65536, 32-bit indices will be used (which may not
+        be supported on some GLES2 devices).
+
         You can adjust the size of the internal pipeline state object pool
         with:
 
             int pipeline_pool_size  - default is 64
 
+        ...and the maximum number of rendering contexts (including the
+        default context, see RENDERING CONTEXTS below) with:
+
+            int context_pool_size   - default is 4
+
+        ...and the maximum number of display lists (see DISPLAY LISTS below)
+        with:
+
+            int list_pool_size      - default is 64
+
         Finally you can change the face winding for front-facing triangles
         and quads:
 
@@ -293,6 +308,8 @@
             sgl_begin_triangles()
             sgl_begin_triangle_strip()
             sgl_begin_quads()
+            sgl_begin_thick_lines()     (see THICK LINES AND ROUND POINTS)
+            sgl_begin_round_points()
 
         ...after sgl_begin_*() specify vertices:
 
@@ -306,6 +323,24 @@
         and/or color is missing, it will be taken from the current texture-coord
         and color 'register'.
 
+        ...or write many vertices at once (for instance pre-built geometry):
+
+            sgl_vertices(const sgl_vertex_t* vertices, int num_vertices)
+
+        ...or reserve space for vertices and write them directly into
+        sokol-gl's internal vertex buffer:
+
+            sgl_vertex_t* sgl_reserve(int num_vertices)
+
+        The returned pointer is only valid until the next call to any
+        other sokol-gl vertex function, sgl_end() or sgl_draw(), all
+        num_vertices vertices must be written. If there's not enough room
+        left in the vertex buffer, sgl_reserve() returns a null pointer
+        and sets the error code SGL_ERROR_VERTICES_FULL. The color of an
+        sgl_vertex_t is packed as 0xAABBGGRR. The bulk functions don't use
+        the current texture-coord and color 'register', and for quads,
+        each quad must consist of 4 vertices.
+
         ...finally, after specifying vertices, call:
 
             sgl_end()
@@ -322,19 +357,22 @@
         call to sgl_draw() through sokol-gfx, and will 'rewind' the internal
         vertex-, uniform- and command-buffers.
 
-    --- sokol-gl tracks a single internal error code which can be
+    --- sokol-gl tracks an internal error code per context which can be
         queried with
 
             sgl_error_t sgl_error(void)
+            sgl_error_t sgl_context_error(sgl_context ctx)
 
         ...which can return the following error codes:
 
         SGL_NO_ERROR                - all OK, no error occurred since last sgl_draw()
-        SGL_ERROR_VERTICES_FULL     - internal vertex buffer is full (checked in sgl_end())
+        SGL_ERROR_VERTICES_FULL     - internal vertex buffer is full (checked in sgl_end(), never
+                                      happens with the grow_buffers option unless out of memory)
         SGL_ERROR_UNIFORMS_FULL     - the internal uniforms buffer is full (checked in sgl_end())
         SGL_ERROR_COMMANDS_FULL     - the internal command buffer is full (checked in sgl_end())
         SGL_ERROR_STACK_OVERFLOW    - matrix- or pipeline-stack overflow
         SGL_ERROR_STACK_UNDERFLOW   - matrix- or pipeline-stack underflow
+        SGL_ERROR_NO_CONTEXT        - the current context handle is invalid
 
         ...if sokol-gl is in an error-state, sgl_draw() will skip any rendering,
         and reset the error code to SGL_NO_ERROR.
@@ -347,7 +385,15 @@
     The only functions which call into sokol_gfx.h are:
         - sgl_setup()
         - sgl_shutdown()
+        - sgl_make_context()
+        - sgl_destroy_context()
+        - sgl_make_pipeline()
+        - sgl_context_make_pipeline()
+        - sgl_destroy_pipeline()
+        - sgl_end_list()
+        - sgl_destroy_list()
         - sgl_draw()
+        - sgl_context_draw()
 
     sgl_setup() must be called after initializing sokol-gfx.
     sgl_shutdown() must be called before shutting down sokol-gfx.
@@ -362,14 +408,20 @@
             - 3 memory buffers are allocated, one for vertex data,
               one for uniform data, and one for commands
             - sokol-gfx resources are created: a (dynamic) vertex buffer,
-              a shader object (using embedded shader source or byte code),
-              and an 8x8 all-white default texture
+              a static index buffer for rendering quads, a shader object
+              (using embedded shader source or byte code), and an 8x8
+              all-white default texture, if supported also a shader
+              and a small vertex buffer with quad corners for thick lines
+              and round points
 
             One vertex is 24 bytes:
                 - float3 position
                 - float2 texture coords
                 - uint32_t color
 
+            (in the sokol-gfx vertex buffer, one vertex is 12 or 16 bytes
+            with a compact vertex layout, see VERTEX LAYOUTS)
+
             One uniform block is 128 bytes:
                 - mat4 model-view-projection matrix
                 - mat4 texture matrix
@@ -389,8 +441,11 @@
             - the 3 memory buffers are freed
 
         sgl_draw():
+            - with the grow_buffers option, recreate the sokol-gfx vertex-
+              and quad-index-buffer if the recorded vertices don't fit
             - copy all recorded vertex data into the dynamic sokol-gfx buffer
-              via a call to sg_update_buffer()
+              via a call to sg_update_buffer() (quads are recorded as 4
+              vertices each, and rendered through a static index buffer)
             - for each recorded command:
                 - if it's a viewport command, call sg_apply_viewport()
                 - if it's a scissor-rect command, call sg_apply_scissor_rect()
@@ -417,13 +472,330 @@
     - the primitive type hasn't changed
     - the primitive type isn't a 'strip type' (no line or triangle strip)
     - the pipeline state object hasn't changed
-    - none of the matrices has changed
+    - none of the matrices has changed (only the projection matrix
+      when the context uses CPU VERTEX TRANSFORM)
     - none of the texture state has changed
 
     Merging a draw command simply means that the number of vertices
     to render in the previous draw command will be incremented by the
     number of vertices in the new draw command.
 
+    RENDERING CONTEXTS
+    ==================
+    All recorded vertices, commands and rendering state (matrix stacks,
+    pipeline stack, current color, texture etc...) live in a 'context'.
+    sgl_setup() creates a default context which is used unless another
+    context has been selected. Additional contexts are useful to record
+    rendering commands for several sokol-gfx render passes in the same
+    frame, or to record rendering commands on different threads.
+
+    To create a context:
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .max_vertices = ...,    // default: 64 * 1024
+            .max_commands = ...,    // default: 16 * 1024
+            .color_format = ...,
+            .depth_format = ...,
+            .sample_count = ...,
+        });
+
+    The pixel formats and sample count must match the render pass where the
+    context will be rendered, each context has its own sokol-gfx vertex
+    buffer.
+
+    To make a context current:
+
+        sgl_set_context(ctx);
+
+    The current context is tracked *per thread*. When a thread hasn't
+    selected a context yet (or has selected an invalid handle), the
+    default context is used. All sokol-gl functions which record rendering
+    state or vertices use the current context of the calling thread.
+    Query the current context with:
+
+        sgl_context sgl_get_context(void)
+
+    ...and the default context with:
+
+        sgl_context sgl_default_context(void)
+
+    To render the recorded commands of the current context call
+    sgl_draw(), to render a specific context call:
+
+        sgl_context_draw(sgl_context ctx)
+
+    Pipeline objects are tied to the context they were created for,
+    because the render pass attributes are baked into the pipeline. Use
+    sgl_make_pipeline() to create a pipeline for the current context, or:
+
+        sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline_desc* desc)
+
+    Destroy a context with sgl_destroy_context() (the default context can't
+    be destroyed, all contexts are destroyed in sgl_shutdown()).
+
+    Regarding threads: different threads may record into different
+    contexts at the same time. The functions which call into sokol_gfx.h
+    (see UNDER THE HOOD) must be called from the sokol-gfx thread, and must
+    not be called for a context while another thread is recording into it.
+
+    ON QUAD RENDERING
+    =================
+    Quads are written as 4 vertices into the vertex buffer, and rendered
+    as indexed triangles through a static index buffer which is created
+    in sgl_setup(). To make this work, the first vertex of a
+    sgl_begin_quads() / sgl_end() sequence is aligned to a multiple of 4
+    in the vertex buffer (which may waste up to 3 vertices), and
+    incomplete quads at the end of a sequence are dropped in sgl_end().
+
+    CPU VERTEX TRANSFORM
+    ====================
+    By default, every change to the model-view or texture matrix prevents
+    the next sgl_begin/end pair from being merged with the previous draw
+    command (see ON DRAW COMMAND MERGING). Code which draws many small
+    objects with a sgl_push_matrix() / sgl_translate() / sgl_pop_matrix()
+    sequence each will thus end up with one draw call per object.
+
+    To avoid this, a context can be created with CPU-side vertex transform
+    enabled:
+
+        sgl_setup(&(sgl_desc_t){
+            .cpu_transform = true,
+            ...
+        });
+
+    ...or for additional contexts:
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .cpu_transform = true,
+            ...
+        });
+
+    In this mode, sgl_end() transforms the recorded vertex positions with
+    the current model-view matrix and the texture coordinates with the
+    current texture matrix (using SSE2 or NEON where available), and only
+    the projection matrix is passed as uniform data to the vertex shader.
+    Changes to the model-view and texture matrices then no longer break
+    draw command merging, only changes to the projection matrix do.
+
+    Caveats:
+        - only affine model-view matrices (with a last row of 0,0,0,1)
+          are applied on the CPU, sgl_begin/end pairs recorded with a
+          projective model-view matrix (for instance from sgl_load_matrix()
+          or sgl_mult_matrix()) fall back to the GPU transform and
+          can't be merged with neighbouring draw commands
+        - matrix changes between sgl_begin() and sgl_end() are not
+          tracked per vertex, all vertices of a sgl_begin/end pair are
+          transformed with the matrices which are current in sgl_end()
+          (this is the same as with the default GPU transform)
+        - the vertex transform costs CPU time in sgl_end(), this usually
+          pays off when the number of vertices per draw call is small
+
+    DRAW STATISTICS
+    ===============
+    To check how effective draw command merging is, call:
+
+        sgl_stats_t sgl_stats(void)
+        sgl_stats_t sgl_context_stats(sgl_context ctx)
+
+    ...this returns the following counters for the last sgl_draw() or
+    sgl_context_draw() call of a context:
+
+        num_begin_end       - number of sgl_begin/end pairs recorded
+        num_draws           - number of sg_draw() calls
+        num_apply_uniforms  - number of sg_apply_uniforms() calls
+        num_vertices        - number of recorded vertices
+
+    ...and the following high-water marks since the context was created,
+    which are useful to tune the max_vertices and max_commands setup
+    parameters:
+
+        peak_vertices       - max number of vertices recorded in a frame
+        peak_commands       - max number of draw commands recorded in a frame
+        peak_uniforms       - max number of uniform blocks recorded in a frame
+
+    The max_commands setup parameter defines the size of both the command-
+    and uniform-buffers, so it must be at least as big as the bigger
+    of peak_commands and peak_uniforms.
+
+    Note that without the grow_buffers option the high-water marks can't
+    be bigger than max_vertices and max_commands.
+
+    The difference between num_begin_end and num_draws is the number
+    of draw calls saved by draw command merging.
+
+    DISPLAY LISTS
+    =============
+    Geometry which doesn't change between frames (like grids, gizmos or
+    static HUD frames) can be recorded once into a display list, which
+    lives in an immutable sokol-gfx vertex buffer. Calling a display list
+    doesn't require any per-vertex CPU work or vertex data upload.
+
+    To record a display list, wrap regular sokol-gl rendering calls
+    (sgl_begin_*() / sgl_end() pairs, viewport- and scissor-rect calls)
+    into:
+
+        sgl_begin_list();
+        ...
+        sgl_list list = sgl_end_list();
+
+    ...this records into the current context as usual, but sgl_end_list()
+    bakes the recorded vertices and commands into a new display list and
+    removes them from the context (so they won't be rendered by the next
+    sgl_draw()). sgl_end_list() returns an invalid handle if an error
+    occurred during recording (for instance when the vertex buffer was full)
+    or if the display list pool is exhausted.
+
+    To render a display list, call:
+
+        sgl_call_list(list);
+
+    ...anywhere where sokol-gl rendering functions can be called (except
+    while recording another display list). The display list will be
+    rendered by the next sgl_draw() in the order it was called relative
+    to the other recorded commands. The model-view and texture matrices
+    which were current during recording are concatenated with the
+    matrices which are current in sgl_call_list(), and the projection
+    matrix of sgl_call_list() is used (the projection matrix is ignored
+    during recording). This means the same display list can be rendered
+    several times per frame at different locations.
+
+    Calling a display list costs one command and one uniform block per
+    uniform block in the list (i.e. per matrix change while recording).
+
+    A display list is tied to the context it was recorded in (like
+    pipeline objects), and uses the pipeline objects and textures which
+    were current during recording, these must not be destroyed while the
+    display list is in use.
+
+    Destroy a display list with:
+
+        sgl_destroy_list(list);
+
+    Display lists which haven't been destroyed explicitly are destroyed in
+    sgl_shutdown().
+
+    VERTEX LAYOUTS
+    ==============
+    By default, vertices are stored as 24 bytes in the sokol-gfx vertex
+    buffer (float3 position, float2 texture coords and a packed color).
+    For 2D rendering this is wasteful, so a context can be created with
+    a compact vertex layout which reduces the vertex data that needs to be
+    uploaded and fetched by the GPU:
+
+        sgl_setup(&(sgl_desc_t){
+            .vertex_layout = SGL_VERTEXLAYOUT_POS2_COLOR,
+            ...
+        });
+
+    ...or for additional contexts:
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .vertex_layout = SGL_VERTEXLAYOUT_POS2_UV16_COLOR,
+            ...
+        });
+
+    The available layouts are:
+
+        SGL_VERTEXLAYOUT_POS3_UV2_COLOR (default, 24 bytes):
+            float3 position, float2 texture coords, ubyte4n color
+        SGL_VERTEXLAYOUT_POS2_COLOR (12 bytes):
+            float2 position and ubyte4n color, for untextured 2D rendering,
+            the z coordinate is always 0.0 and the position is used as
+            texture coordinate
+        SGL_VERTEXLAYOUT_POS2_UV16_COLOR (16 bytes):
+            float2 position, ushort2n texture coords and ubyte4n color, the
+            z coordinate is always 0.0, and texture coordinates are clamped
+            to the 0.0..1.0 range (before the texture matrix is applied)
+
+    Vertices are still recorded as sgl_vertex_t (so all vertex functions,
+    CPU vertex transform and display lists work as usual) and converted to
+    the compact layout when they are copied into the sokol-gfx vertex buffer
+    in sgl_draw() (or sgl_end_list()). All layouts use the same shader,
+    missing position components are filled in by the vertex fetch.
+
+    Pipeline objects are created for the vertex layout of their context,
+    custom shaders must declare the same vertex attributes as the
+    builtin shader.
+
+    GROWING BUFFERS
+    ===============
+    By default the vertex-, uniform- and command-buffers of a context have
+    a fixed size (defined by max_vertices and max_commands), and when one
+    of the buffers overflows, sgl_draw() skips rendering for the entire
+    frame. To avoid this, a context can be created with growing buffers:
+
+        sgl_setup(&(sgl_desc_t){
+            .grow_buffers = true,
+            ...
+        });
+
+    ...or for additional contexts:
+
+        sgl_context ctx = sgl_make_context(&(sgl_context_desc_t){
+            .grow_buffers = true,
+            ...
+        });
+
+    In this mode, max_vertices and max_commands only define the initial
+    buffer sizes. When a buffer is full, its memory buffer is reallocated
+    with (at least) twice the size. The sokol-gfx vertex buffer (and the
+    quad index buffer) is recreated in the next sgl_draw() if it is too
+    small to hold the recorded vertices. Buffers never shrink.
+
+    Caveats:
+        - the quad index buffer always uses 32-bit indices in this mode,
+          so that the pipeline objects stay valid when the buffer grows
+        - recreating the vertex buffer happens inside sgl_draw(), which
+          causes a short hitch in the frame where it happens, use the
+          high-water marks in sgl_stats() (see DRAW STATISTICS) to find
+          good initial sizes
+
+    THICK LINES AND ROUND POINTS
+    ============================
+    The regular line and point primitives are rendered by the 3D-API's
+    native lines and points which are always 1 pixel wide and aliased on
+    most platforms. For wide lines and big points use:
+
+        sgl_line_width(4.0f);
+        sgl_aa_width(1.0f);
+        sgl_begin_thick_lines();
+        sgl_v2f(x0, y0); sgl_v2f(x1, y1);   // one segment per 2 vertices
+        ...
+        sgl_end();
+
+        sgl_point_size(8.0f);
+        sgl_begin_round_points();
+        sgl_v2f(x, y);
+        ...
+        sgl_end();
+
+    Line width, point size and antialiasing width are in pixels relative
+    to the viewport size of the last sgl_viewport() call, and are captured
+    in sgl_end(). This means that sgl_viewport() must be called before
+    recording thick lines or round points, otherwise they fall back to
+    regular lines and points (with a one-time log message). Each line
+    segment and point is rendered as one instance of a quad which is
+    expanded in the vertex shader, the recorded vertices are read directly
+    as per-instance data, so thick lines and round points don't use more
+    vertex memory than regular lines and points.
+
+    The antialiased edges are rendered by fading out the alpha channel,
+    so they need a pipeline object with alpha blending enabled.
+
+    Caveats:
+        - line segments have square ends, joints of connected segments
+          are not filled
+        - the texture matrix is not applied (the texture matrix slot in
+          the uniform block holds the line parameters), except with
+          CPU vertex transform
+        - line segments are not clipped against the near plane before
+          expansion, segments crossing the near plane render incorrectly
+        - GPU-expanded primitives require instancing support and the builtin
+          shader, if the backend has no instancing (GLES2 without the
+          instanced-arrays extension), in the WebGPU backend or with
+          pipelines using custom shaders, sgl_begin_thick_lines() and
+          sgl_begin_round_points() fall back to regular lines and points
+
     LICENSE
     =======
     zlib/libpng license
@@ -477,6 +849,19 @@ extern "C" {
 /* sokol_gl pipeline handle (created with sgl_make_pipeline()) */
 typedef struct sgl_pipeline { uint32_t id; } sgl_pipeline;
 
+/* a context handle (created with sgl_make_context()) */
+typedef struct sgl_context { uint32_t id; } sgl_context;
+
+/* a display list handle (created with sgl_begin_list() / sgl_end_list()) */
+typedef struct sgl_list { uint32_t id; } sgl_list;
+
+/* a vertex for the bulk functions sgl_vertices() and sgl_reserve() */
+typedef struct sgl_vertex_t {
+    float pos[3];
+    float uv[2];
+    uint32_t rgba;  /* packed as 0xAABBGGRR */
+} sgl_vertex_t;
+
 /*
     sgl_error_t
 
@@ -490,18 +875,69 @@ typedef enum sgl_error_t {
     SGL_ERROR_COMMANDS_FULL,
     SGL_ERROR_STACK_OVERFLOW,
     SGL_ERROR_STACK_UNDERFLOW,
+    SGL_ERROR_NO_CONTEXT,
 } sgl_error_t;
 
+/*
+    sgl_vertex_layout
+
+    The vertex layout of the sokol-gfx vertex buffers of a context
+    (see VERTEX LAYOUTS), vertices are always recorded as sgl_vertex_t
+    and converted when uploaded.
+*/
+typedef enum sgl_vertex_layout {
+    _SGL_VERTEXLAYOUT_DEFAULT,          /* value 0 reserved for default-init */
+    SGL_VERTEXLAYOUT_POS3_UV2_COLOR,    /* 24 bytes: float3 position, float2 texcoord, ubyte4n color (default) */
+    SGL_VERTEXLAYOUT_POS2_COLOR,        /* 12 bytes: float2 position, ubyte4n color */
+    SGL_VERTEXLAYOUT_POS2_UV16_COLOR,   /* 16 bytes: float2 position, ushort2n texcoord, ubyte4n color */
+    _SGL_VERTEXLAYOUT_NUM,
+    _SGL_VERTEXLAYOUT_FORCE_U32 = 0x7FFFFFFF
+} sgl_vertex_layout;
+
+/*
+    sgl_context_desc_t
+
+    Describes the initialization parameters of a rendering context.
+    Creating additional contexts is useful if you want to render
+    in separate sokol-gfx passes.
+*/
+typedef struct sgl_context_desc_t {
+    int max_vertices;       /* default: 64 * 1024 */
+    int max_commands;       /* default: 16 * 1024 */
+    sg_pixel_format color_format;
+    sg_pixel_format depth_format;
+    int sample_count;
+    bool cpu_transform;     /* transform vertices on the CPU (see CPU VERTEX TRANSFORM) */
+    bool grow_buffers;      /* grow buffers instead of failing when full (see GROWING BUFFERS) */
+    sgl_vertex_layout vertex_layout;    /* default: SGL_VERTEXLAYOUT_POS3_UV2_COLOR */
+} sgl_context_desc_t;
+
 typedef struct sgl_desc_t {
-    int max_vertices;       /* size for vertex buffer */
-    int max_commands;       /* size of uniform- and command-buffers */
+    int max_vertices;       /* size for vertex buffer (of the default context) */
+    int max_commands;       /* size of uniform- and command-buffers (of the default context) */
     int pipeline_pool_size; /* size of the internal pipeline pool, default is 64 */
+    int context_pool_size;  /* max number of contexts (including default context), default is 4 */
+    int list_pool_size;     /* max number of display lists, default is 64 */
     sg_pixel_format color_format;
     sg_pixel_format depth_format;
     int sample_count;
     sg_face_winding face_winding; /* default front face winding is CCW */
+    bool cpu_transform;     /* CPU-side vertex transform in the default context */
+    bool grow_buffers;      /* growing buffers in the default context */
+    sgl_vertex_layout vertex_layout;    /* vertex layout of the default context */
 } sgl_desc_t;
 
+/* draw statistics of the last sgl_draw() (see DRAW STATISTICS) */
+typedef struct sgl_stats_t {
+    int num_begin_end;
+    int num_draws;
+    int num_apply_uniforms;
+    int num_vertices;
+    int peak_vertices;      /* high-water mark of recorded vertices since context creation */
+    int peak_commands;      /* high-water mark of recorded draw commands since context creation */
+    int peak_uniforms;      /* high-water mark of recorded uniform blocks since context creation */
+} sgl_stats_t;
+
 /* setup/shutdown/misc */
 SOKOL_GL_API_DECL void sgl_setup(const sgl_desc_t* desc);
 SOKOL_GL_API_DECL void sgl_shutdown(void);
@@ -510,8 +946,19 @@ SOKOL_GL_API_DECL void sgl_defaults(void);
 SOKOL_GL_API_DECL float sgl_rad(float deg);
 SOKOL_GL_API_DECL float sgl_deg(float rad);
 
+/* context functions */
+SOKOL_GL_API_DECL sgl_context sgl_make_context(const sgl_context_desc_t* desc);
+SOKOL_GL_API_DECL void sgl_destroy_context(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_set_context(sgl_context ctx);
+SOKOL_GL_API_DECL sgl_context sgl_get_context(void);
+SOKOL_GL_API_DECL sgl_context sgl_default_context(void);
+SOKOL_GL_API_DECL sgl_error_t sgl_context_error(sgl_context ctx);
+SOKOL_GL_API_DECL sgl_stats_t sgl_stats(void);
+SOKOL_GL_API_DECL sgl_stats_t sgl_context_stats(sgl_context ctx);
+
 /* create and destroy pipeline objects */
 SOKOL_GL_API_DECL sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc* desc);
+SOKOL_GL_API_DECL sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline_desc* desc);
 SOKOL_GL_API_DECL void sgl_destroy_pipeline(sgl_pipeline pip);
 
 /* render state functions */
@@ -556,6 +1003,11 @@ SOKOL_GL_API_DECL void sgl_c3b(uint8_t r, uint8_t g, uint8_t b);
 SOKOL_GL_API_DECL void sgl_c4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 SOKOL_GL_API_DECL void sgl_c1i(uint32_t rgba);
 
+/* size parameters of thick lines and round points in pixels (valid inside or outside begin/end) */
+SOKOL_GL_API_DECL void sgl_line_width(float w);
+SOKOL_GL_API_DECL void sgl_point_size(float s);
+SOKOL_GL_API_DECL void sgl_aa_width(float w);
+
 /* define primitives, each begin/end is one draw command */
 SOKOL_GL_API_DECL void sgl_begin_points(void);
 SOKOL_GL_API_DECL void sgl_begin_lines(void);
@@ -563,6 +1015,8 @@ SOKOL_GL_API_DECL void sgl_begin_line_strip(void);
 SOKOL_GL_API_DECL void sgl_begin_triangles(void);
 SOKOL_GL_API_DECL void sgl_begin_triangle_strip(void);
 SOKOL_GL_API_DECL void sgl_begin_quads(void);
+SOKOL_GL_API_DECL void sgl_begin_thick_lines(void);
+SOKOL_GL_API_DECL void sgl_begin_round_points(void);
 SOKOL_GL_API_DECL void sgl_v2f(float x, float y);
 SOKOL_GL_API_DECL void sgl_v3f(float x, float y, float z);
 SOKOL_GL_API_DECL void sgl_v2f_t2f(float x, float y, float u, float v);
@@ -587,10 +1041,20 @@ SOKOL_GL_API_DECL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v, float r, float g, float b, float a);
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 SOKOL_GL_API_DECL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v, uint32_t rgba);
+SOKOL_GL_API_DECL void sgl_vertices(const sgl_vertex_t* vertices, int num_vertices);
+SOKOL_GL_API_DECL sgl_vertex_t* sgl_reserve(int num_vertices);
 SOKOL_GL_API_DECL void sgl_end(void);
 
-/* render everything */
+/* display lists */
+SOKOL_GL_API_DECL void sgl_begin_list(void);
+SOKOL_GL_API_DECL sgl_list sgl_end_list(void);
+SOKOL_GL_API_DECL void sgl_call_list(sgl_list list);
+SOKOL_GL_API_DECL void sgl_destroy_list(sgl_list list);
+
+/* render everything recorded in the current context */
 SOKOL_GL_API_DECL void sgl_draw(void);
+/* render everything recorded in a specific context */
+SOKOL_GL_API_DECL void sgl_context_draw(sgl_context ctx);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -598,6 +1062,8 @@ SOKOL_GL_API_DECL void sgl_draw(void);
 /* reference-based equivalents for C++ */
 inline void sgl_setup(const sgl_desc_t& desc) { return sgl_setup(&desc); }
 inline sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc& desc) { return sgl_make_pipeline(&desc); }
+inline sgl_context sgl_make_context(const sgl_context_desc_t& desc) { return sgl_make_context(&desc); }
+inline sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline_desc& desc) { return sgl_context_make_pipeline(ctx, &desc); }
 #endif
 #endif /* SOKOL_GL_INCLUDED */
 
@@ -613,6 +1079,16 @@ inline sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc& desc) { return sgl
 #define M_PI 3.14159265358979323846264338327
 #endif
 
+#if !defined(SGL_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define _SGL_SSE2 (1)
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #define _SGL_NEON (1)
+        #include <arm_neon.h>
+    #endif
+#endif
+
 #ifndef SOKOL_API_IMPL
     #define SOKOL_API_IMPL
 #endif
@@ -1936,6 +2412,246 @@ static const char* _sgl_fs_source_dummy = "";
 #error "Please define one of SOKOL_GLCORE33, SOKOL_GLES2, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU or SOKOL_DUMMY_BACKEND!"
 #endif
 
+/*
+    Shaders for GPU-expanded thick lines and round points (see THICK LINES
+    AND ROUND POINTS). One instance is one line segment or point, which is
+    expanded into a screen-space quad in the vertex shader. These are
+    embedded as source code since there's no byte code for them, and
+    there's no WGPU version (WGPU requires SPIR-V byte code), instead
+    thick lines and round points fall back to regular lines and points
+    on WGPU. vs_params[0..3] is the mvp matrix, vs_params[4] is (viewport
+    width, viewport height, half line width, antialiasing width) and
+    vs_params[5].x is 1.0 for round points.
+
+    @vs thick_vs
+    uniform vs_params {
+        vec4 vs_params[8];
+    };
+    in vec4 position0;
+    in vec2 texcoord0;
+    in vec4 color0;
+    in vec4 position1;
+    in vec2 texcoord1;
+    in vec4 color1;
+    in vec2 corner;     // x: 0 at segment start, 1 at segment end, y: -1 or +1 across
+    out vec4 uv;
+    out vec4 color;
+    out vec4 edge;
+    void main() {
+        mat4 mvp = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]);
+        vec2 half_vp = vs_params[4].xy * 0.5;
+        float ext = vs_params[4].z + vs_params[4].w * 0.5;
+        vec4 p0 = mvp * position0;
+        vec4 p1 = mvp * position1;
+        vec2 dir = (p1.xy / p1.w - p0.xy / p0.w) * half_vp;
+        float len = length(dir);
+        dir = (len > 0.0001) ? (dir / len) : vec2(1.0, 0.0);
+        float along = corner.x * 2.0 - 1.0;
+        vec2 offset = (dir * along + vec2(-dir.y, dir.x) * corner.y) * ext;
+        vec4 p = mix(p0, p1, corner.x);
+        gl_Position = vec4(p.xy + (offset / half_vp) * p.w, p.zw);
+        uv = vec4(mix(texcoord0, texcoord1, corner.x), 0.0, 1.0);
+        color = mix(color0, color1, corner.x);
+        edge = vec4(along * ext * vs_params[5].x, corner.y * ext, vs_params[4].z, vs_params[4].w);
+    }
+    @end
+
+    @fs thick_fs
+    uniform sampler2D tex;
+    in vec4 uv;
+    in vec4 color;
+    in vec4 edge;
+    out vec4 frag_color;
+    void main() {
+        float alpha = clamp((edge.z - length(edge.xy)) / max(edge.w, 0.0001) + 0.5, 0.0, 1.0);
+        frag_color = texture(tex, uv.xy) * color * vec4(1.0, 1.0, 1.0, alpha);
+    }
+    @end
+*/
+#if defined(SOKOL_GLCORE33)
+static const char* _sgl_thick_vs_source_glsl330 =
+    "#version 330\n"
+    "uniform vec4 vs_params[8];\n"
+    "layout(location = 0) in vec4 position0;\n"
+    "layout(location = 1) in vec2 texcoord0;\n"
+    "layout(location = 2) in vec4 color0;\n"
+    "layout(location = 3) in vec4 position1;\n"
+    "layout(location = 4) in vec2 texcoord1;\n"
+    "layout(location = 5) in vec4 color1;\n"
+    "layout(location = 6) in vec2 corner;\n"
+    "out vec4 uv;\n"
+    "out vec4 color;\n"
+    "out vec4 edge;\n"
+    "void main() {\n"
+    "    mat4 mvp = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]);\n"
+    "    vec2 half_vp = vs_params[4].xy * 0.5;\n"
+    "    float ext = vs_params[4].z + vs_params[4].w * 0.5;\n"
+    "    vec4 p0 = mvp * position0;\n"
+    "    vec4 p1 = mvp * position1;\n"
+    "    vec2 dir = (p1.xy / p1.w - p0.xy / p0.w) * half_vp;\n"
+    "    float len = length(dir);\n"
+    "    dir = (len > 0.0001) ? (dir / len) : vec2(1.0, 0.0);\n"
+    "    float along = corner.x * 2.0 - 1.0;\n"
+    "    vec2 offset = (dir * along + vec2(-dir.y, dir.x) * corner.y) * ext;\n"
+    "    vec4 p = mix(p0, p1, corner.x);\n"
+    "    gl_Position = vec4(p.xy + (offset / half_vp) * p.w, p.zw);\n"
+    "    uv = vec4(mix(texcoord0, texcoord1, corner.x), 0.0, 1.0);\n"
+    "    color = mix(color0, color1, corner.x);\n"
+    "    edge = vec4(along * ext * vs_params[5].x, corner.y * ext, vs_params[4].z, vs_params[4].w);\n"
+    "}\n";
+static const char* _sgl_thick_fs_source_glsl330 =
+    "#version 330\n"
+    "uniform sampler2D tex;\n"
+    "in vec4 uv;\n"
+    "in vec4 color;\n"
+    "in vec4 edge;\n"
+    "layout(location = 0) out vec4 frag_color;\n"
+    "void main() {\n"
+    "    float alpha = clamp((edge.z - length(edge.xy)) / max(edge.w, 0.0001) + 0.5, 0.0, 1.0);\n"
+    "    frag_color = texture(tex, uv.xy) * color * vec4(1.0, 1.0, 1.0, alpha);\n"
+    "}\n";
+#elif defined(SOKOL_GLES2) || defined(SOKOL_GLES3)
+static const char* _sgl_thick_vs_source_glsl100 =
+    "#version 100\n"
+    "uniform vec4 vs_params[8];\n"
+    "attribute vec4 position0;\n"
+    "attribute vec2 texcoord0;\n"
+    "attribute vec4 color0;\n"
+    "attribute vec4 position1;\n"
+    "attribute vec2 texcoord1;\n"
+    "attribute vec4 color1;\n"
+    "attribute vec2 corner;\n"
+    "varying vec4 uv;\n"
+    "varying vec4 color;\n"
+    "varying vec4 edge;\n"
+    "void main() {\n"
+    "    mat4 mvp = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]);\n"
+    "    vec2 half_vp = vs_params[4].xy * 0.5;\n"
+    "    float ext = vs_params[4].z + vs_params[4].w * 0.5;\n"
+    "    vec4 p0 = mvp * position0;\n"
+    "    vec4 p1 = mvp * position1;\n"
+    "    vec2 dir = (p1.xy / p1.w - p0.xy / p0.w) * half_vp;\n"
+    "    float len = length(dir);\n"
+    "    dir = (len > 0.0001) ? (dir / len) : vec2(1.0, 0.0);\n"
+    "    float along = corner.x * 2.0 - 1.0;\n"
+    "    vec2 offset = (dir * along + vec2(-dir.y, dir.x) * corner.y) * ext;\n"
+    "    vec4 p = mix(p0, p1, corner.x);\n"
+    "    gl_Position = vec4(p.xy + (offset / half_vp) * p.w, p.zw);\n"
+    "    uv = vec4(mix(texcoord0, texcoord1, corner.x), 0.0, 1.0);\n"
+    "    color = mix(color0, color1, corner.x);\n"
+    "    edge = vec4(along * ext * vs_params[5].x, corner.y * ext, vs_params[4].z, vs_params[4].w);\n"
+    "}\n";
+static const char* _sgl_thick_fs_source_glsl100 =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform sampler2D tex;\n"
+    "varying highp vec4 uv;\n"
+    "varying highp vec4 color;\n"
+    "varying highp vec4 edge;\n"
+    "void main() {\n"
+    "    float alpha = clamp((edge.z - length(edge.xy)) / max(edge.w, 0.0001) + 0.5, 0.0, 1.0);\n"
+    "    gl_FragColor = texture2D(tex, uv.xy) * color * vec4(1.0, 1.0, 1.0, alpha);\n"
+    "}\n";
+#elif defined(SOKOL_METAL)
+static const char* _sgl_thick_vs_source_metal =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "struct vs_params { float4 p[8]; };\n"
+    "struct vs_in {\n"
+    "    float4 position0 [[attribute(0)]];\n"
+    "    float2 texcoord0 [[attribute(1)]];\n"
+    "    float4 color0 [[attribute(2)]];\n"
+    "    float4 position1 [[attribute(3)]];\n"
+    "    float2 texcoord1 [[attribute(4)]];\n"
+    "    float4 color1 [[attribute(5)]];\n"
+    "    float2 corner [[attribute(6)]];\n"
+    "};\n"
+    "struct vs_out {\n"
+    "    float4 uv [[user(locn0)]];\n"
+    "    float4 color [[user(locn1)]];\n"
+    "    float4 edge [[user(locn2)]];\n"
+    "    float4 pos [[position]];\n"
+    "};\n"
+    "vertex vs_out main0(vs_in in [[stage_in]], constant vs_params& params [[buffer(0)]]) {\n"
+    "    vs_out out;\n"
+    "    float4x4 mvp = float4x4(params.p[0], params.p[1], params.p[2], params.p[3]);\n"
+    "    float2 half_vp = params.p[4].xy * 0.5;\n"
+    "    float ext = params.p[4].z + params.p[4].w * 0.5;\n"
+    "    float4 p0 = mvp * in.position0;\n"
+    "    float4 p1 = mvp * in.position1;\n"
+    "    float2 dir = (p1.xy / p1.w - p0.xy / p0.w) * half_vp;\n"
+    "    float len = length(dir);\n"
+    "    dir = (len > 0.0001) ? (dir / len) : float2(1.0, 0.0);\n"
+    "    float along = in.corner.x * 2.0 - 1.0;\n"
+    "    float2 offset = (dir * along + float2(-dir.y, dir.x) * in.corner.y) * ext;\n"
+    "    float4 p = mix(p0, p1, in.corner.x);\n"
+    "    out.pos = float4(p.xy + (offset / half_vp) * p.w, p.zw);\n"
+    "    out.uv = float4(mix(in.texcoord0, in.texcoord1, in.corner.x), 0.0, 1.0);\n"
+    "    out.color = mix(in.color0, in.color1, in.corner.x);\n"
+    "    out.edge = float4(along * ext * params.p[5].x, in.corner.y * ext, params.p[4].z, params.p[4].w);\n"
+    "    return out;\n"
+    "}\n";
+static const char* _sgl_thick_fs_source_metal =
+    "#include <metal_stdlib>\n"
+    "using namespace metal;\n"
+    "struct fs_in {\n"
+    "    float4 uv [[user(locn0)]];\n"
+    "    float4 color [[user(locn1)]];\n"
+    "    float4 edge [[user(locn2)]];\n"
+    "};\n"
+    "fragment float4 main0(fs_in in [[stage_in]], texture2d<float> tex [[texture(0)]], sampler smp [[sampler(0)]]) {\n"
+    "    float alpha = clamp((in.edge.z - length(in.edge.xy)) / max(in.edge.w, 0.0001) + 0.5, 0.0, 1.0);\n"
+    "    return tex.sample(smp, in.uv.xy) * in.color * float4(1.0, 1.0, 1.0, alpha);\n"
+    "}\n";
+#elif defined(SOKOL_D3D11)
+static const char* _sgl_thick_vs_source_hlsl4 =
+    "cbuffer params : register(b0) { float4 vs_params[8]; };\n"
+    "struct vs_in {\n"
+    "    float4 position0 : TEXCOORD0;\n"
+    "    float2 texcoord0 : TEXCOORD1;\n"
+    "    float4 color0 : TEXCOORD2;\n"
+    "    float4 position1 : TEXCOORD3;\n"
+    "    float2 texcoord1 : TEXCOORD4;\n"
+    "    float4 color1 : TEXCOORD5;\n"
+    "    float2 corner : TEXCOORD6;\n"
+    "};\n"
+    "struct vs_out {\n"
+    "    float4 uv : TEXCOORD0;\n"
+    "    float4 color : TEXCOORD1;\n"
+    "    float4 edge : TEXCOORD2;\n"
+    "    float4 pos : SV_Position;\n"
+    "};\n"
+    "vs_out main(vs_in inp) {\n"
+    "    vs_out outp;\n"
+    "    float4x4 mvp = float4x4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]);\n"
+    "    float2 half_vp = vs_params[4].xy * 0.5;\n"
+    "    float ext = vs_params[4].z + vs_params[4].w * 0.5;\n"
+    "    float4 p0 = mul(inp.position0, mvp);\n"
+    "    float4 p1 = mul(inp.position1, mvp);\n"
+    "    float2 dir = (p1.xy / p1.w - p0.xy / p0.w) * half_vp;\n"
+    "    float len = length(dir);\n"
+    "    dir = (len > 0.0001) ? (dir / len) : float2(1.0, 0.0);\n"
+    "    float along = inp.corner.x * 2.0 - 1.0;\n"
+    "    float2 offset = (dir * along + float2(-dir.y, dir.x) * inp.corner.y) * ext;\n"
+    "    float4 p = lerp(p0, p1, inp.corner.x);\n"
+    "    outp.pos = float4(p.xy + (offset / half_vp) * p.w, p.zw);\n"
+    "    outp.uv = float4(lerp(inp.texcoord0, inp.texcoord1, inp.corner.x), 0.0, 1.0);\n"
+    "    outp.color = lerp(inp.color0, inp.color1, inp.corner.x);\n"
+    "    outp.edge = float4(along * ext * vs_params[5].x, inp.corner.y * ext, vs_params[4].z, vs_params[4].w);\n"
+    "    return outp;\n"
+    "}\n";
+static const char* _sgl_thick_fs_source_hlsl4 =
+    "Texture2D<float4> tex : register(t0);\n"
+    "SamplerState smp : register(s0);\n"
+    "float4 main(float4 uv : TEXCOORD0, float4 color : TEXCOORD1, float4 edge : TEXCOORD2) : SV_Target0 {\n"
+    "    float alpha = clamp((edge.z - length(edge.xy)) / max(edge.w, 0.0001) + 0.5, 0.0, 1.0);\n"
+    "    return tex.Sample(smp, uv.xy) * color * float4(1.0, 1.0, 1.0, alpha);\n"
+    "}\n";
+#elif defined(SOKOL_DUMMY_BACKEND)
+static const char* _sgl_thick_vs_source_dummy = "";
+static const char* _sgl_thick_fs_source_dummy = "";
+#endif
+
 typedef enum {
     SGL_PRIMITIVETYPE_POINTS = 0,
     SGL_PRIMITIVETYPE_LINES,
@@ -1943,6 +2659,8 @@ typedef enum {
     SGL_PRIMITIVETYPE_TRIANGLES,
     SGL_PRIMITIVETYPE_TRIANGLE_STRIP,
     SGL_PRIMITIVETYPE_QUADS,
+    SGL_PRIMITIVETYPE_THICK_LINES,      /* GPU-expanded, one instance per line segment */
+    SGL_PRIMITIVETYPE_ROUND_POINTS,     /* GPU-expanded, one instance per point */
     SGL_NUM_PRIMITIVE_TYPES,
 } _sgl_primitive_type_t;
 
@@ -1960,6 +2678,7 @@ typedef struct {
 
 typedef struct {
     _sgl_slot_t slot;
+    sgl_context ctx;    /* the context this pipeline was created for */
     sg_pipeline pip[SGL_NUM_PRIMITIVE_TYPES];
 } _sgl_pipeline_t;
 
@@ -1975,11 +2694,19 @@ typedef enum {
     SGL_NUM_MATRIXMODES
 } _sgl_matrix_mode_t;
 
+typedef sgl_vertex_t _sgl_vertex_t;
+
+/* compact vertex layouts, only used in sokol-gfx vertex buffers */
 typedef struct {
-    float pos[3];
-    float uv[2];
+    float pos[2];
+    uint32_t rgba;
+} _sgl_vertex_pos2_color_t;
+
+typedef struct {
+    float pos[2];
+    uint16_t uv[2];
     uint32_t rgba;
-} _sgl_vertex_t;
+} _sgl_vertex_pos2_uv16_color_t;
 
 typedef struct {
     float v[4][4];
@@ -1994,6 +2721,7 @@ typedef enum {
     SGL_COMMAND_DRAW,
     SGL_COMMAND_VIEWPORT,
     SGL_COMMAND_SCISSOR_RECT,
+    SGL_COMMAND_CALL_LIST,
 } _sgl_command_type_t;
 
 typedef struct {
@@ -2002,6 +2730,8 @@ typedef struct {
     int base_vertex;
     int num_vertices;
     int uniform_index;
+    bool indexed;           /* true for quads, rendered via the quad index buffer */
+    int vertices_per_instance;  /* 0 for regular draws, 2 for thick lines, 1 for round points */
 } _sgl_draw_args_t;
 
 typedef struct {
@@ -2014,10 +2744,16 @@ typedef struct {
     bool origin_top_left;
 } _sgl_scissor_rect_args_t;
 
+typedef struct {
+    sgl_list list;
+    int uniform_index;      /* first of the list's uniform blocks, premultiplied with the caller's matrices */
+} _sgl_call_list_args_t;
+
 typedef union {
     _sgl_draw_args_t draw;
     _sgl_viewport_args_t viewport;
     _sgl_scissor_rect_args_t scissor_rect;
+    _sgl_call_list_args_t call_list;
 } _sgl_args_t;
 
 typedef struct {
@@ -2025,9 +2761,29 @@ typedef struct {
     _sgl_args_t args;
 } _sgl_command_t;
 
+typedef struct {
+    _sgl_slot_t slot;
+    sgl_context ctx;            /* the context this list was recorded in */
+    int num_vertices;
+    int num_uniforms;
+    int num_commands;
+    _sgl_uniform_t* uniforms;   /* matrices relative to the caller of sgl_call_list() */
+    _sgl_command_t* commands;   /* base_vertex and uniform_index are relative to the list */
+    bool* thick_uniforms;       /* uniform blocks of thick lines and round points (or null) */
+    sg_buffer vbuf;             /* immutable vertex buffer */
+    sg_buffer quad_ibuf;        /* only if the list contains quads */
+} _sgl_list_t;
+
+typedef struct {
+    _sgl_pool_t pool;
+    _sgl_list_t* lists;
+} _sgl_list_pool_t;
+
 #define _SGL_INVALID_SLOT_INDEX (0)
 #define _SGL_MAX_STACK_DEPTH (64)
 #define _SGL_DEFAULT_PIPELINE_POOL_SIZE (64)
+#define _SGL_DEFAULT_CONTEXT_POOL_SIZE (4)
+#define _SGL_DEFAULT_LIST_POOL_SIZE (64)
 #define _SGL_DEFAULT_MAX_VERTICES (1<<16)
 #define _SGL_DEFAULT_MAX_COMMANDS (1<<14)
 #define _SGL_SLOT_SHIFT (16)
@@ -2035,8 +2791,8 @@ typedef struct {
 #define _SGL_SLOT_MASK (_SGL_MAX_POOL_SIZE-1)
 
 typedef struct {
-    uint32_t init_cookie;
-    sgl_desc_t desc;
+    _sgl_slot_t slot;
+    sgl_context_desc_t desc;
 
     int num_vertices;
     int num_uniforms;
@@ -2047,6 +2803,9 @@ typedef struct {
     _sgl_vertex_t* vertices;
     _sgl_uniform_t* uniforms;
     _sgl_command_t* commands;
+    int vertex_size;            /* size of one vertex in the sokol-gfx vertex buffer */
+    int num_packed_vertices;
+    void* packed_vertices;      /* staging buffer for compact vertex layouts */
 
     /* state tracking */
     int base_vertex;
@@ -2059,14 +2818,33 @@ typedef struct {
     sg_image cur_img;
     bool texturing_enabled;
     bool matrix_dirty;      /* reset in sgl_end(), set in any of the matrix stack functions */
+    bool thick_uniform;     /* true if the current uniform block belongs to thick lines or round points */
+    bool cpu_uniform;       /* true if the current uniform block belongs to CPU-transformed vertices */
+    float line_width;       /* in pixels, for thick lines */
+    float point_size;       /* in pixels, for round points */
+    float aa_width;         /* in pixels, for thick lines and round points */
+    float viewport_w;       /* last sgl_viewport() size, needed for pixel sizes */
+    float viewport_h;
+    bool viewport_warned;   /* true after logging a thick primitive without sgl_viewport() */
+    int num_begin_end;      /* number of sgl_begin/end pairs since the last sgl_draw() */
+    sgl_stats_t stats;      /* statistics of the last sgl_draw() */
+    int peak_vertices;      /* high-water marks since context creation */
+    int peak_commands;
+    int peak_uniforms;
+
+    /* display list recording */
+    bool in_list;
+    int list_base_vertex;
+    int list_base_uniform;
+    int list_base_command;  /* 0 when not recording a list, prevents merging with commands before the list */
+    int list_base_begin_end;
 
     /* sokol-gfx resources */
     sg_buffer vbuf;
-    sg_image def_img;   /* a default white texture */
-    sg_shader shd;
-    sg_bindings bind;
+    int vbuf_num_vertices;      /* capacity of vbuf and quad_ibuf, may lag behind num_vertices with grow_buffers */
+    sg_buffer quad_ibuf;        /* static index buffer for rendering quads */
+    sg_index_type quad_index_type;
     sgl_pipeline def_pip;
-    _sgl_pipeline_pool_t pip_pool;
 
     /* pipeline stack */
     int pip_tos;
@@ -2076,9 +2854,39 @@ typedef struct {
     _sgl_matrix_mode_t cur_matrix_mode;
     int matrix_tos[SGL_NUM_MATRIXMODES];
     _sgl_matrix_t matrix_stack[SGL_NUM_MATRIXMODES][_SGL_MAX_STACK_DEPTH];
+} _sgl_context_t;
+
+typedef struct {
+    _sgl_pool_t pool;
+    _sgl_context_t* contexts;
+} _sgl_context_pool_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    sgl_desc_t desc;
+    sg_image def_img;   /* a default white texture */
+    sg_shader shd;
+    sg_shader thick_shd;        /* for thick lines and round points, invalid if not supported */
+    sg_buffer corner_vbuf;      /* per-vertex quad corners for thick lines and round points */
+    _sgl_pipeline_pool_t pip_pool;
+    _sgl_context_pool_t context_pool;
+    _sgl_list_pool_t list_pool;
+    sgl_context def_ctx_id;
 } _sgl_t;
 static _sgl_t _sgl;
 
+/* the current context is tracked per thread, an invalid id means 'default context' */
+#if defined(__cplusplus)
+#define _SGL_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define _SGL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define _SGL_THREAD_LOCAL __thread
+#else
+#define _SGL_THREAD_LOCAL _Thread_local
+#endif
+static _SGL_THREAD_LOCAL sgl_context _sgl_cur_ctx_id;
+
 /*== PRIVATE FUNCTIONS =======================================================*/
 
 static void _sgl_init_pool(_sgl_pool_t* pool, int num) {
@@ -2229,37 +3037,83 @@ static sgl_pipeline _sgl_alloc_pipeline(void) {
     return res;
 }
 
-static void _sgl_init_pipeline(sgl_pipeline pip_id, const sg_pipeline_desc* in_desc) {
-    SOKOL_ASSERT((pip_id.id != SG_INVALID_ID) && in_desc);
+/*
+    Initialize the position, texcoord and color vertex attributes (attrs[0..2])
+    for a vertex layout, offset is added to the attribute offsets. Missing
+    position components are filled with z=0, w=1 by the vertex fetch.
+*/
+static void _sgl_init_vertex_attrs(sgl_vertex_layout layout, sg_vertex_attr_desc* attrs, int offset) {
+    sg_vertex_attr_desc* pos = &attrs[0];
+    sg_vertex_attr_desc* uv = &attrs[1];
+    sg_vertex_attr_desc* rgba = &attrs[2];
+    switch (layout) {
+        case SGL_VERTEXLAYOUT_POS2_COLOR:
+            /* no texture coords, feed the position into the texcoord attribute */
+            pos->offset = offset + (int)offsetof(_sgl_vertex_pos2_color_t, pos);
+            pos->format = SG_VERTEXFORMAT_FLOAT2;
+            uv->offset = offset + (int)offsetof(_sgl_vertex_pos2_color_t, pos);
+            uv->format = SG_VERTEXFORMAT_FLOAT2;
+            rgba->offset = offset + (int)offsetof(_sgl_vertex_pos2_color_t, rgba);
+            rgba->format = SG_VERTEXFORMAT_UBYTE4N;
+            break;
+        case SGL_VERTEXLAYOUT_POS2_UV16_COLOR:
+            pos->offset = offset + (int)offsetof(_sgl_vertex_pos2_uv16_color_t, pos);
+            pos->format = SG_VERTEXFORMAT_FLOAT2;
+            uv->offset = offset + (int)offsetof(_sgl_vertex_pos2_uv16_color_t, uv);
+            uv->format = SG_VERTEXFORMAT_USHORT2N;
+            rgba->offset = offset + (int)offsetof(_sgl_vertex_pos2_uv16_color_t, rgba);
+            rgba->format = SG_VERTEXFORMAT_UBYTE4N;
+            break;
+        default:
+            pos->offset = offset + (int)offsetof(_sgl_vertex_t, pos);
+            pos->format = SG_VERTEXFORMAT_FLOAT3;
+            uv->offset = offset + (int)offsetof(_sgl_vertex_t, uv);
+            uv->format = SG_VERTEXFORMAT_FLOAT2;
+            rgba->offset = offset + (int)offsetof(_sgl_vertex_t, rgba);
+            rgba->format = SG_VERTEXFORMAT_UBYTE4N;
+            break;
+    }
+}
+
+/*
+    Create the pipeline for GPU-expanded thick lines or round points:
+    the recorded vertices are read as per-instance data (2 vertices
+    per instance for lines, 1 for points), and a quad is built from
+    the per-vertex corner buffer and the first 6 quad indices.
+*/
+static sg_pipeline _sgl_make_thick_pipeline(_sgl_context_t* ctx, const sg_pipeline_desc* patched_desc, bool lines) {
+    sg_pipeline_desc desc = *patched_desc;
+    const int vertices_per_instance = lines ? 2 : 1;
+    memset(&desc.layout, 0, sizeof(desc.layout));
+    desc.layout.buffers[0].stride = ctx->vertex_size * vertices_per_instance;
+    desc.layout.buffers[0].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    desc.layout.buffers[1].stride = 2 * (int)sizeof(float);
+    _sgl_init_vertex_attrs(ctx->desc.vertex_layout, &desc.layout.attrs[0], 0);
+    _sgl_init_vertex_attrs(ctx->desc.vertex_layout, &desc.layout.attrs[3], ctx->vertex_size * (vertices_per_instance - 1));
+    desc.layout.attrs[6].buffer_index = 1;
+    desc.layout.attrs[6].format = SG_VERTEXFORMAT_FLOAT2;
+    desc.shader = _sgl.thick_shd;
+    desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+    desc.index_type = ctx->quad_index_type;
+    return sg_make_pipeline(&desc);
+}
+
+static void _sgl_init_pipeline(_sgl_context_t* ctx, sgl_pipeline pip_id, const sg_pipeline_desc* in_desc) {
+    SOKOL_ASSERT(ctx && (pip_id.id != SG_INVALID_ID) && in_desc);
 
     /* create a new desc with 'patched' shader and pixel format state */
     sg_pipeline_desc desc = *in_desc;
-    desc.layout.buffers[0].stride = sizeof(_sgl_vertex_t);
-    {
-        sg_vertex_attr_desc* pos = &desc.layout.attrs[0];
-        pos->offset = offsetof(_sgl_vertex_t, pos);
-        pos->format = SG_VERTEXFORMAT_FLOAT3;
-    }
-    {
-        sg_vertex_attr_desc* uv = &desc.layout.attrs[1];
-        uv->offset = offsetof(_sgl_vertex_t, uv);
-        uv->format = SG_VERTEXFORMAT_FLOAT2;
-    }
-    {
-        sg_vertex_attr_desc* rgba = &desc.layout.attrs[2];
-        rgba->offset = offsetof(_sgl_vertex_t, rgba);
-        rgba->format = SG_VERTEXFORMAT_UBYTE4N;
-    }
+    desc.layout.buffers[0].stride = ctx->vertex_size;
+    _sgl_init_vertex_attrs(ctx->desc.vertex_layout, &desc.layout.attrs[0], 0);
     if (in_desc->shader.id == SG_INVALID_ID) {
         desc.shader = _sgl.shd;
     }
-    desc.index_type = SG_INDEXTYPE_NONE;
-    desc.sample_count = _sgl.desc.sample_count;
+    desc.sample_count = ctx->desc.sample_count;
     if (desc.face_winding == _SG_FACEWINDING_DEFAULT) {
         desc.face_winding = _sgl.desc.face_winding;
     }
-    desc.depth.pixel_format = _sgl.desc.depth_format;
-    desc.colors[0].pixel_format = _sgl.desc.color_format;
+    desc.depth.pixel_format = ctx->desc.depth_format;
+    desc.colors[0].pixel_format = ctx->desc.color_format;
     if (desc.colors[0].write_mask == _SG_COLORMASK_DEFAULT) {
         desc.colors[0].write_mask = SG_COLORMASK_RGB;
     }
@@ -2267,7 +3121,20 @@ static void _sgl_init_pipeline(sgl_pipeline pip_id, const sg_pipeline_desc* in_d
     _sgl_pipeline_t* pip = _sgl_lookup_pipeline(pip_id.id);
     SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
     pip->slot.state = SG_RESOURCESTATE_VALID;
+    pip->ctx.id = ctx->slot.id;
     for (int i = 0; i < SGL_NUM_PRIMITIVE_TYPES; i++) {
+        if ((i == SGL_PRIMITIVETYPE_THICK_LINES) || (i == SGL_PRIMITIVETYPE_ROUND_POINTS)) {
+            /* only with the builtin shader, otherwise sgl_end() falls back to regular lines and points */
+            if ((in_desc->shader.id == SG_INVALID_ID) && (_sgl.thick_shd.id != SG_INVALID_ID)) {
+                pip->pip[i] = _sgl_make_thick_pipeline(ctx, &desc, i == SGL_PRIMITIVETYPE_THICK_LINES);
+                if (pip->pip[i].id == SG_INVALID_ID) {
+                    SOKOL_LOG("sokol_gl.h: failed to create pipeline object");
+                    pip->slot.state = SG_RESOURCESTATE_FAILED;
+                }
+            }
+            continue;
+        }
+        desc.index_type = SG_INDEXTYPE_NONE;
         switch (i) {
             case SGL_PRIMITIVETYPE_POINTS:
                 desc.primitive_type = SG_PRIMITIVETYPE_POINTS;
@@ -2282,29 +3149,27 @@ static void _sgl_init_pipeline(sgl_pipeline pip_id, const sg_pipeline_desc* in_d
                 desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
                 break;
             case SGL_PRIMITIVETYPE_TRIANGLE_STRIP:
-            case SGL_PRIMITIVETYPE_QUADS:
                 desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLE_STRIP;
                 break;
+            case SGL_PRIMITIVETYPE_QUADS:
+                /* quads are rendered as indexed triangles */
+                desc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+                desc.index_type = ctx->quad_index_type;
+                break;
         }
-        if (SGL_PRIMITIVETYPE_QUADS == i) {
-            /* quads are emulated via triangles, use the same pipeline object */
-            pip->pip[i] = pip->pip[SGL_PRIMITIVETYPE_TRIANGLES];
-        }
-        else {
-            pip->pip[i] = sg_make_pipeline(&desc);
-            if (pip->pip[i].id == SG_INVALID_ID) {
-                SOKOL_LOG("sokol_gl.h: failed to create pipeline object");
-                pip->slot.state = SG_RESOURCESTATE_FAILED;
-            }
+        pip->pip[i] = sg_make_pipeline(&desc);
+        if (pip->pip[i].id == SG_INVALID_ID) {
+            SOKOL_LOG("sokol_gl.h: failed to create pipeline object");
+            pip->slot.state = SG_RESOURCESTATE_FAILED;
         }
     }
 }
 
-static sgl_pipeline _sgl_make_pipeline(const sg_pipeline_desc* desc) {
-    SOKOL_ASSERT(desc);
+static sgl_pipeline _sgl_make_pipeline(_sgl_context_t* ctx, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(ctx && desc);
     sgl_pipeline pip_id = _sgl_alloc_pipeline();
     if (pip_id.id != SG_INVALID_ID) {
-        _sgl_init_pipeline(pip_id, desc);
+        _sgl_init_pipeline(ctx, pip_id, desc);
     }
     else {
         SOKOL_LOG("sokol_gl.h: pipeline pool exhausted!");
@@ -2316,9 +3181,7 @@ static void _sgl_destroy_pipeline(sgl_pipeline pip_id) {
     _sgl_pipeline_t* pip = _sgl_lookup_pipeline(pip_id.id);
     if (pip) {
         for (int i = 0; i < SGL_NUM_PRIMITIVE_TYPES; i++) {
-            if (i != SGL_PRIMITIVETYPE_QUADS) {
-                sg_destroy_pipeline(pip->pip[i]);
-            }
+            sg_destroy_pipeline(pip->pip[i]);
         }
         _sgl_reset_pipeline(pip);
         _sgl_pool_free_index(&_sgl.pip_pool.pool, _sgl_slot_index(pip_id.id));
@@ -2336,57 +3199,162 @@ static sg_pipeline _sgl_get_pipeline(sgl_pipeline pip_id, _sgl_primitive_type_t
     }
 }
 
-static inline void _sgl_begin(_sgl_primitive_type_t mode) {
-    _sgl.in_begin = true;
-    _sgl.base_vertex = _sgl.cur_vertex;
-    _sgl.vtx_count = 0;
-    _sgl.cur_prim_type = mode;
+/*
+    Reallocate a CPU-side buffer with at least twice the size, keeping
+    the first num_used items, returns a null pointer if out of memory.
+*/
+static void* _sgl_grow_buffer(void* items, int* num_items, int num_used, int min_num, size_t item_size) {
+    int new_num = *num_items * 2;
+    if (new_num < min_num) {
+        new_num = min_num;
+    }
+    void* new_items = SOKOL_MALLOC((size_t)new_num * item_size);
+    if (new_items) {
+        memcpy(new_items, items, (size_t)num_used * item_size);
+        SOKOL_FREE(items);
+        *num_items = new_num;
+    }
+    return new_items;
+}
+
+static bool _sgl_grow_vertices(_sgl_context_t* ctx, int min_num) {
+    if (ctx->desc.grow_buffers) {
+        void* items = _sgl_grow_buffer(ctx->vertices, &ctx->num_vertices, ctx->cur_vertex, min_num, sizeof(_sgl_vertex_t));
+        if (items) {
+            ctx->vertices = (_sgl_vertex_t*) items;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _sgl_grow_uniforms(_sgl_context_t* ctx) {
+    if (ctx->desc.grow_buffers) {
+        void* items = _sgl_grow_buffer(ctx->uniforms, &ctx->num_uniforms, ctx->cur_uniform, 0, sizeof(_sgl_uniform_t));
+        if (items) {
+            ctx->uniforms = (_sgl_uniform_t*) items;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _sgl_grow_commands(_sgl_context_t* ctx) {
+    if (ctx->desc.grow_buffers) {
+        void* items = _sgl_grow_buffer(ctx->commands, &ctx->num_commands, ctx->cur_command, 0, sizeof(_sgl_command_t));
+        if (items) {
+            ctx->commands = (_sgl_command_t*) items;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* align the next vertex to a multiple of 4 to match the quad index buffer */
+static inline void _sgl_align_vertex(_sgl_context_t* ctx) {
+    int aligned_vertex = (ctx->cur_vertex + 3) & ~3;
+    if ((aligned_vertex > ctx->num_vertices) && !_sgl_grow_vertices(ctx, aligned_vertex)) {
+        aligned_vertex = ctx->num_vertices;
+    }
+    ctx->cur_vertex = aligned_vertex;
+}
+
+static inline void _sgl_begin(_sgl_context_t* ctx, _sgl_primitive_type_t mode) {
+    ctx->in_begin = true;
+    if (SGL_PRIMITIVETYPE_QUADS == mode) {
+        _sgl_align_vertex(ctx);
+    }
+    ctx->base_vertex = ctx->cur_vertex;
+    ctx->vtx_count = 0;
+    ctx->cur_prim_type = mode;
+}
+
+static inline bool _sgl_is_thick(_sgl_primitive_type_t prim_type) {
+    return (SGL_PRIMITIVETYPE_THICK_LINES == prim_type) || (SGL_PRIMITIVETYPE_ROUND_POINTS == prim_type);
+}
+
+/*
+    Thick lines and round points don't use a texture matrix, instead the
+    texture matrix slot of their uniform block carries the viewport size,
+    the half line width / point size, the antialiasing width and a flag
+    for round points.
+*/
+static void _sgl_thick_params(_sgl_context_t* ctx, _sgl_primitive_type_t prim_type, _sgl_matrix_t* params) {
+    const bool points = (SGL_PRIMITIVETYPE_ROUND_POINTS == prim_type);
+    memset(params, 0, sizeof(_sgl_matrix_t));
+    SOKOL_ASSERT((ctx->viewport_w > 0.0f) && (ctx->viewport_h > 0.0f));
+    params->v[0][0] = ctx->viewport_w;
+    params->v[0][1] = ctx->viewport_h;
+    params->v[0][2] = 0.5f * (points ? ctx->point_size : ctx->line_width);
+    params->v[0][3] = ctx->aa_width;
+    params->v[1][0] = points ? 1.0f : 0.0f;
+}
+
+/* with CPU vertex transform, only projection matrix changes require new uniforms */
+static inline void _sgl_matrix_changed(_sgl_context_t* ctx) {
+    if (!ctx->desc.cpu_transform || (SGL_MATRIXMODE_PROJECTION == ctx->cur_matrix_mode)) {
+        ctx->matrix_dirty = true;
+    }
+}
+
+static void _sgl_rewind(_sgl_context_t* ctx) {
+    ctx->base_vertex = 0;
+    ctx->cur_vertex = 0;
+    ctx->cur_uniform = 0;
+    ctx->cur_command = 0;
+    ctx->error = SGL_NO_ERROR;
+    ctx->matrix_dirty = true;
+    ctx->num_begin_end = 0;
 }
 
-static void _sgl_rewind(void) {
-    _sgl.base_vertex = 0;
-    _sgl.cur_vertex = 0;
-    _sgl.cur_uniform = 0;
-    _sgl.cur_command = 0;
-    _sgl.error = SGL_NO_ERROR;
-    _sgl.matrix_dirty = true;
+static inline _sgl_vertex_t* _sgl_next_vertex(_sgl_context_t* ctx) {
+    if ((ctx->cur_vertex < ctx->num_vertices) || _sgl_grow_vertices(ctx, ctx->cur_vertex + 1)) {
+        return &ctx->vertices[ctx->cur_vertex++];
+    }
+    else {
+        ctx->error = SGL_ERROR_VERTICES_FULL;
+        return 0;
+    }
 }
 
-static inline _sgl_vertex_t* _sgl_next_vertex(void) {
-    if (_sgl.cur_vertex < _sgl.num_vertices) {
-        return &_sgl.vertices[_sgl.cur_vertex++];
+static inline _sgl_vertex_t* _sgl_reserve_vertices(_sgl_context_t* ctx, int num) {
+    if (((ctx->cur_vertex + num) <= ctx->num_vertices) || _sgl_grow_vertices(ctx, ctx->cur_vertex + num)) {
+        _sgl_vertex_t* vtx = &ctx->vertices[ctx->cur_vertex];
+        ctx->cur_vertex += num;
+        ctx->vtx_count += num;
+        return vtx;
     }
     else {
-        _sgl.error = SGL_ERROR_VERTICES_FULL;
+        ctx->error = SGL_ERROR_VERTICES_FULL;
         return 0;
     }
 }
 
-static inline _sgl_uniform_t* _sgl_next_uniform(void) {
-    if (_sgl.cur_uniform < _sgl.num_uniforms) {
-        return &_sgl.uniforms[_sgl.cur_uniform++];
+static inline _sgl_uniform_t* _sgl_next_uniform(_sgl_context_t* ctx) {
+    if ((ctx->cur_uniform < ctx->num_uniforms) || _sgl_grow_uniforms(ctx)) {
+        return &ctx->uniforms[ctx->cur_uniform++];
     }
     else {
-        _sgl.error = SGL_ERROR_UNIFORMS_FULL;
+        ctx->error = SGL_ERROR_UNIFORMS_FULL;
         return 0;
     }
 }
 
-static inline _sgl_command_t* _sgl_prev_command(void) {
-    if (_sgl.cur_command > 0) {
-        return &_sgl.commands[_sgl.cur_command - 1];
+static inline _sgl_command_t* _sgl_prev_command(_sgl_context_t* ctx) {
+    if (ctx->cur_command > ctx->list_base_command) {
+        return &ctx->commands[ctx->cur_command - 1];
     }
     else {
         return 0;
     }
 }
 
-static inline _sgl_command_t* _sgl_next_command(void) {
-    if (_sgl.cur_command < _sgl.num_commands) {
-        return &_sgl.commands[_sgl.cur_command++];
+static inline _sgl_command_t* _sgl_next_command(_sgl_context_t* ctx) {
+    if ((ctx->cur_command < ctx->num_commands) || _sgl_grow_commands(ctx)) {
+        return &ctx->commands[ctx->cur_command++];
     }
     else {
-        _sgl.error = SGL_ERROR_COMMANDS_FULL;
+        ctx->error = SGL_ERROR_COMMANDS_FULL;
         return 0;
     }
 }
@@ -2409,26 +3377,15 @@ static inline uint32_t _sgl_pack_rgbaf(float r, float g, float b, float a) {
     return _sgl_pack_rgbab(r_u8, g_u8, b_u8, a_u8);
 }
 
-static inline void _sgl_vtx(float x, float y, float z, float u, float v, uint32_t rgba) {
-    SOKOL_ASSERT(_sgl.in_begin);
-    _sgl_vertex_t* vtx;
-    /* handle non-native primitive types */
-    if ((_sgl.cur_prim_type == SGL_PRIMITIVETYPE_QUADS) && ((_sgl.vtx_count & 3) == 3)) {
-        /* for quads, before writing the last quad vertex, reuse
-           the first and third vertex to start the second triangle in the quad
-        */
-        vtx = _sgl_next_vertex();
-        if (vtx) { *vtx = *(vtx - 3); }
-        vtx = _sgl_next_vertex();
-        if (vtx) { *vtx = *(vtx - 2); }
-    }
-    vtx = _sgl_next_vertex();
+static inline void _sgl_vtx(_sgl_context_t* ctx, float x, float y, float z, float u, float v, uint32_t rgba) {
+    SOKOL_ASSERT(ctx->in_begin);
+    _sgl_vertex_t* vtx = _sgl_next_vertex(ctx);
     if (vtx) {
         vtx->pos[0] = x; vtx->pos[1] = y; vtx->pos[2] = z;
         vtx->uv[0] = u; vtx->uv[1] = v;
         vtx->rgba = rgba;
     }
-    _sgl.vtx_count++;
+    ctx->vtx_count++;
 }
 
 static void _sgl_identity(_sgl_matrix_t* m) {
@@ -2449,14 +3406,109 @@ static void _sgl_transpose(_sgl_matrix_t* dst, const _sgl_matrix_t* m) {
 }
 
 /* _sgl_rotate, _sgl_frustum, _sgl_ortho from MESA m_matric.c */
+/* p = a * b, p may be identical with a or b */
 static void _sgl_matmul4(_sgl_matrix_t* p, const _sgl_matrix_t* a, const _sgl_matrix_t* b) {
-    for (int r = 0; r < 4; r++) {
-        float ai0=a->v[0][r], ai1=a->v[1][r], ai2=a->v[2][r], ai3=a->v[3][r];
-        p->v[0][r] = ai0*b->v[0][0] + ai1*b->v[0][1] + ai2*b->v[0][2] + ai3*b->v[0][3];
-        p->v[1][r] = ai0*b->v[1][0] + ai1*b->v[1][1] + ai2*b->v[1][2] + ai3*b->v[1][3];
-        p->v[2][r] = ai0*b->v[2][0] + ai1*b->v[2][1] + ai2*b->v[2][2] + ai3*b->v[2][3];
-        p->v[3][r] = ai0*b->v[3][0] + ai1*b->v[3][1] + ai2*b->v[3][2] + ai3*b->v[3][3];
-    }
+    #if defined(_SGL_SSE2)
+        const __m128 a0 = _mm_loadu_ps(a->v[0]);
+        const __m128 a1 = _mm_loadu_ps(a->v[1]);
+        const __m128 a2 = _mm_loadu_ps(a->v[2]);
+        const __m128 a3 = _mm_loadu_ps(a->v[3]);
+        __m128 res[4];
+        for (int c = 0; c < 4; c++) {
+            res[c] = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(b->v[c][0])), _mm_mul_ps(a1, _mm_set1_ps(b->v[c][1]))),
+                _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(b->v[c][2])), _mm_mul_ps(a3, _mm_set1_ps(b->v[c][3]))));
+        }
+        for (int c = 0; c < 4; c++) {
+            _mm_storeu_ps(p->v[c], res[c]);
+        }
+    #elif defined(_SGL_NEON)
+        const float32x4_t a0 = vld1q_f32(a->v[0]);
+        const float32x4_t a1 = vld1q_f32(a->v[1]);
+        const float32x4_t a2 = vld1q_f32(a->v[2]);
+        const float32x4_t a3 = vld1q_f32(a->v[3]);
+        float32x4_t res[4];
+        for (int c = 0; c < 4; c++) {
+            float32x4_t r = vmulq_n_f32(a0, b->v[c][0]);
+            r = vmlaq_n_f32(r, a1, b->v[c][1]);
+            r = vmlaq_n_f32(r, a2, b->v[c][2]);
+            res[c] = vmlaq_n_f32(r, a3, b->v[c][3]);
+        }
+        for (int c = 0; c < 4; c++) {
+            vst1q_f32(p->v[c], res[c]);
+        }
+    #else
+        _sgl_matrix_t res;
+        for (int r = 0; r < 4; r++) {
+            float ai0=a->v[0][r], ai1=a->v[1][r], ai2=a->v[2][r], ai3=a->v[3][r];
+            res.v[0][r] = ai0*b->v[0][0] + ai1*b->v[0][1] + ai2*b->v[0][2] + ai3*b->v[0][3];
+            res.v[1][r] = ai0*b->v[1][0] + ai1*b->v[1][1] + ai2*b->v[1][2] + ai3*b->v[1][3];
+            res.v[2][r] = ai0*b->v[2][0] + ai1*b->v[2][1] + ai2*b->v[2][2] + ai3*b->v[2][3];
+            res.v[3][r] = ai0*b->v[3][0] + ai1*b->v[3][1] + ai2*b->v[3][2] + ai3*b->v[3][3];
+        }
+        *p = res;
+    #endif
+}
+
+/* true if the last row of a matrix is 0,0,0,1 */
+static inline bool _sgl_is_affine(const _sgl_matrix_t* m) {
+    return (m->v[0][3] == 0.0f) && (m->v[1][3] == 0.0f) && (m->v[2][3] == 0.0f) && (m->v[3][3] == 1.0f);
+}
+
+/*
+    Transform vertex positions by the model-view matrix and texture
+    coordinates by the texture matrix (for the CPU vertex transform
+    mode), the model-view matrix must be affine.
+*/
+static void _sgl_transform_vertices(_sgl_vertex_t* vtx, int num, const _sgl_matrix_t* mv, const _sgl_matrix_t* tm) {
+    #if defined(_SGL_SSE2)
+        const __m128 m0 = _mm_loadu_ps(mv->v[0]);
+        const __m128 m1 = _mm_loadu_ps(mv->v[1]);
+        const __m128 m2 = _mm_loadu_ps(mv->v[2]);
+        const __m128 m3 = _mm_loadu_ps(mv->v[3]);
+        const __m128 t0 = _mm_loadu_ps(tm->v[0]);
+        const __m128 t1 = _mm_loadu_ps(tm->v[1]);
+        const __m128 t3 = _mm_loadu_ps(tm->v[3]);
+        for (int i = 0; i < num; i++, vtx++) {
+            const __m128 pos = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(m0, _mm_set1_ps(vtx->pos[0])), _mm_mul_ps(m1, _mm_set1_ps(vtx->pos[1]))),
+                _mm_add_ps(_mm_mul_ps(m2, _mm_set1_ps(vtx->pos[2])), m3));
+            const __m128 uv = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(t0, _mm_set1_ps(vtx->uv[0])), _mm_mul_ps(t1, _mm_set1_ps(vtx->uv[1]))),
+                t3);
+            _mm_storel_pi((__m64*)vtx->pos, pos);
+            _mm_store_ss(&vtx->pos[2], _mm_shuffle_ps(pos, pos, _MM_SHUFFLE(2,2,2,2)));
+            _mm_storel_pi((__m64*)vtx->uv, uv);
+        }
+    #elif defined(_SGL_NEON)
+        const float32x4_t m0 = vld1q_f32(mv->v[0]);
+        const float32x4_t m1 = vld1q_f32(mv->v[1]);
+        const float32x4_t m2 = vld1q_f32(mv->v[2]);
+        const float32x4_t m3 = vld1q_f32(mv->v[3]);
+        const float32x2_t t0 = vld1_f32(tm->v[0]);
+        const float32x2_t t1 = vld1_f32(tm->v[1]);
+        const float32x2_t t3 = vld1_f32(tm->v[3]);
+        for (int i = 0; i < num; i++, vtx++) {
+            float32x4_t pos = vmlaq_n_f32(m3, m0, vtx->pos[0]);
+            pos = vmlaq_n_f32(pos, m1, vtx->pos[1]);
+            pos = vmlaq_n_f32(pos, m2, vtx->pos[2]);
+            float32x2_t uv = vmla_n_f32(t3, t0, vtx->uv[0]);
+            uv = vmla_n_f32(uv, t1, vtx->uv[1]);
+            vst1_f32(vtx->pos, vget_low_f32(pos));
+            vtx->pos[2] = vgetq_lane_f32(pos, 2);
+            vst1_f32(vtx->uv, uv);
+        }
+    #else
+        for (int i = 0; i < num; i++, vtx++) {
+            const float x = vtx->pos[0], y = vtx->pos[1], z = vtx->pos[2];
+            const float u = vtx->uv[0], v = vtx->uv[1];
+            vtx->pos[0] = mv->v[0][0]*x + mv->v[1][0]*y + mv->v[2][0]*z + mv->v[3][0];
+            vtx->pos[1] = mv->v[0][1]*x + mv->v[1][1]*y + mv->v[2][1]*z + mv->v[3][1];
+            vtx->pos[2] = mv->v[0][2]*x + mv->v[1][2]*y + mv->v[2][2]*z + mv->v[3][2];
+            vtx->uv[0] = tm->v[0][0]*u + tm->v[1][0]*v + tm->v[3][0];
+            vtx->uv[1] = tm->v[0][1]*u + tm->v[1][1]*v + tm->v[3][1];
+        }
+    #endif
 }
 
 static void _sgl_mul(_sgl_matrix_t* dst, const _sgl_matrix_t* m) {
@@ -2622,59 +3674,565 @@ static void _sgl_lookat(_sgl_matrix_t* dst,
 }
 
 /* current top-of-stack projection matrix */
-static inline _sgl_matrix_t* _sgl_matrix_projection(void) {
-    return &_sgl.matrix_stack[SGL_MATRIXMODE_PROJECTION][_sgl.matrix_tos[SGL_MATRIXMODE_PROJECTION]];
+static inline _sgl_matrix_t* _sgl_matrix_projection(_sgl_context_t* ctx) {
+    return &ctx->matrix_stack[SGL_MATRIXMODE_PROJECTION][ctx->matrix_tos[SGL_MATRIXMODE_PROJECTION]];
 }
 
 /* get top-of-stack modelview matrix */
-static inline _sgl_matrix_t* _sgl_matrix_modelview(void) {
-    return &_sgl.matrix_stack[SGL_MATRIXMODE_MODELVIEW][_sgl.matrix_tos[SGL_MATRIXMODE_MODELVIEW]];
+static inline _sgl_matrix_t* _sgl_matrix_modelview(_sgl_context_t* ctx) {
+    return &ctx->matrix_stack[SGL_MATRIXMODE_MODELVIEW][ctx->matrix_tos[SGL_MATRIXMODE_MODELVIEW]];
 }
 
 /* get top-of-stack texture matrix */
-static inline _sgl_matrix_t* _sgl_matrix_texture(void) {
-    return &_sgl.matrix_stack[SGL_MATRIXMODE_TEXTURE][_sgl.matrix_tos[SGL_MATRIXMODE_TEXTURE]];
+static inline _sgl_matrix_t* _sgl_matrix_texture(_sgl_context_t* ctx) {
+    return &ctx->matrix_stack[SGL_MATRIXMODE_TEXTURE][ctx->matrix_tos[SGL_MATRIXMODE_TEXTURE]];
 }
 
 /* get pointer to current top-of-stack of current matrix mode */
-static inline _sgl_matrix_t* _sgl_matrix(void) {
-    return &_sgl.matrix_stack[_sgl.cur_matrix_mode][_sgl.matrix_tos[_sgl.cur_matrix_mode]];
+static inline _sgl_matrix_t* _sgl_matrix(_sgl_context_t* ctx) {
+    return &ctx->matrix_stack[ctx->cur_matrix_mode][ctx->matrix_tos[ctx->cur_matrix_mode]];
 }
 
-/*== PUBLIC FUNCTIONS ========================================================*/
-SOKOL_API_IMPL void sgl_setup(const sgl_desc_t* desc) {
+static void _sgl_setup_context_pool(const sgl_desc_t* desc) {
     SOKOL_ASSERT(desc);
-    memset(&_sgl, 0, sizeof(_sgl));
-    _sgl.init_cookie = _SGL_INIT_COOKIE;
-    _sgl.desc = *desc;
-    _sgl.desc.pipeline_pool_size = _sgl_def(_sgl.desc.pipeline_pool_size, _SGL_DEFAULT_PIPELINE_POOL_SIZE);
-    _sgl.desc.max_vertices = _sgl_def(_sgl.desc.max_vertices, _SGL_DEFAULT_MAX_VERTICES);
-    _sgl.desc.max_commands = _sgl_def(_sgl.desc.max_commands, _SGL_DEFAULT_MAX_COMMANDS);
-    _sgl.desc.face_winding = _sgl_def(_sgl.desc.face_winding, SG_FACEWINDING_CCW);
+    /* note: the pools here will have an additional item, since slot 0 is reserved */
+    SOKOL_ASSERT((desc->context_pool_size > 0) && (desc->context_pool_size < _SGL_MAX_POOL_SIZE));
+    _sgl_init_pool(&_sgl.context_pool.pool, desc->context_pool_size);
+    size_t pool_byte_size = sizeof(_sgl_context_t) * (size_t)_sgl.context_pool.pool.size;
+    _sgl.context_pool.contexts = (_sgl_context_t*) SOKOL_MALLOC(pool_byte_size);
+    SOKOL_ASSERT(_sgl.context_pool.contexts);
+    memset(_sgl.context_pool.contexts, 0, pool_byte_size);
+}
 
-    /* allocate buffers and pools */
-    _sgl.num_vertices = _sgl.desc.max_vertices;
-    _sgl.num_uniforms = _sgl.desc.max_commands;
-    _sgl.num_commands = _sgl.num_uniforms;
-    _sgl.vertices = (_sgl_vertex_t*) SOKOL_MALLOC((size_t)_sgl.num_vertices * sizeof(_sgl_vertex_t));
-    SOKOL_ASSERT(_sgl.vertices);
-    _sgl.uniforms = (_sgl_uniform_t*) SOKOL_MALLOC((size_t)_sgl.num_uniforms * sizeof(_sgl_uniform_t));
-    SOKOL_ASSERT(_sgl.uniforms);
-    _sgl.commands = (_sgl_command_t*) SOKOL_MALLOC((size_t)_sgl.num_commands * sizeof(_sgl_command_t));
-    SOKOL_ASSERT(_sgl.commands);
-    _sgl_setup_pipeline_pool(&_sgl.desc);
+static void _sgl_discard_context_pool(void) {
+    SOKOL_FREE(_sgl.context_pool.contexts); _sgl.context_pool.contexts = 0;
+    _sgl_discard_pool(&_sgl.context_pool.pool);
+}
 
-    /* create sokol-gfx resource objects */
-    sg_push_debug_group("sokol-gl");
+/* get context pointer with id-check, returns 0 if no match */
+static _sgl_context_t* _sgl_lookup_context(uint32_t ctx_id) {
+    if (SG_INVALID_ID != ctx_id) {
+        int slot_index = _sgl_slot_index(ctx_id);
+        SOKOL_ASSERT((slot_index > _SGL_INVALID_SLOT_INDEX) && (slot_index < _sgl.context_pool.pool.size));
+        _sgl_context_t* ctx = &_sgl.context_pool.contexts[slot_index];
+        if (ctx->slot.id == ctx_id) {
+            return ctx;
+        }
+    }
+    return 0;
+}
+
+/* make context id from uint32_t id */
+static sgl_context _sgl_make_ctx_id(uint32_t ctx_id) {
+    sgl_context ctx;
+    ctx.id = ctx_id;
+    return ctx;
+}
+
+/* the current context of the calling thread, or the default context */
+static inline _sgl_context_t* _sgl_cur_ctx(void) {
+    if (SG_INVALID_ID != _sgl_cur_ctx_id.id) {
+        return _sgl_lookup_context(_sgl_cur_ctx_id.id);
+    }
+    else {
+        return _sgl_lookup_context(_sgl.def_ctx_id.id);
+    }
+}
+
+static sgl_context_desc_t _sgl_context_desc_defaults(const sgl_context_desc_t* desc) {
+    sgl_context_desc_t res = *desc;
+    res.max_vertices = _sgl_def(desc->max_vertices, _SGL_DEFAULT_MAX_VERTICES);
+    res.max_commands = _sgl_def(desc->max_commands, _SGL_DEFAULT_MAX_COMMANDS);
+    res.vertex_layout = _sgl_def(desc->vertex_layout, SGL_VERTEXLAYOUT_POS3_UV2_COLOR);
+    return res;
+}
+
+static int _sgl_vertex_size(sgl_vertex_layout layout) {
+    switch (layout) {
+        case SGL_VERTEXLAYOUT_POS2_COLOR:       return (int)sizeof(_sgl_vertex_pos2_color_t);
+        case SGL_VERTEXLAYOUT_POS2_UV16_COLOR:  return (int)sizeof(_sgl_vertex_pos2_uv16_color_t);
+        default:                                return (int)sizeof(_sgl_vertex_t);
+    }
+}
+
+static inline uint16_t _sgl_pack_unorm16(float v) {
+    return (uint16_t)(_sgl_clamp(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+/* convert recorded vertices into a compact vertex layout */
+static void _sgl_pack_vertices(void* dst, const _sgl_vertex_t* src, int num, sgl_vertex_layout layout) {
+    switch (layout) {
+        case SGL_VERTEXLAYOUT_POS2_COLOR:
+            {
+                _sgl_vertex_pos2_color_t* v = (_sgl_vertex_pos2_color_t*) dst;
+                for (int i = 0; i < num; i++, v++, src++) {
+                    v->pos[0] = src->pos[0];
+                    v->pos[1] = src->pos[1];
+                    v->rgba = src->rgba;
+                }
+            }
+            break;
+        case SGL_VERTEXLAYOUT_POS2_UV16_COLOR:
+            {
+                _sgl_vertex_pos2_uv16_color_t* v = (_sgl_vertex_pos2_uv16_color_t*) dst;
+                for (int i = 0; i < num; i++, v++, src++) {
+                    v->pos[0] = src->pos[0];
+                    v->pos[1] = src->pos[1];
+                    v->uv[0] = _sgl_pack_unorm16(src->uv[0]);
+                    v->uv[1] = _sgl_pack_unorm16(src->uv[1]);
+                    v->rgba = src->rgba;
+                }
+            }
+            break;
+        default:
+            memcpy(dst, src, (size_t)num * sizeof(_sgl_vertex_t));
+            break;
+    }
+}
+
+/* create a static index buffer for rendering quads (4 vertices and 6 indices per quad) */
+static sg_buffer _sgl_make_quad_index_buffer(sg_index_type index_type, int num_vertices) {
+    const int num_quads = num_vertices / 4;
+    const int num_indices = num_quads * 6;
+    const size_t index_size = (index_type == SG_INDEXTYPE_UINT32) ? sizeof(uint32_t) : sizeof(uint16_t);
+    void* indices = SOKOL_MALLOC((size_t)num_indices * index_size);
+    SOKOL_ASSERT(indices);
+    for (int i = 0; i < num_quads; i++) {
+        const uint32_t base = (uint32_t)(i * 4);
+        const uint32_t quad[6] = { base, base+1, base+2, base, base+2, base+3 };
+        for (int k = 0; k < 6; k++) {
+            if (index_type == SG_INDEXTYPE_UINT32) {
+                ((uint32_t*)indices)[i*6 + k] = quad[k];
+            }
+            else {
+                ((uint16_t*)indices)[i*6 + k] = (uint16_t)quad[k];
+            }
+        }
+    }
+    sg_buffer_desc ibuf_desc;
+    memset(&ibuf_desc, 0, sizeof(ibuf_desc));
+    ibuf_desc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    ibuf_desc.usage = SG_USAGE_IMMUTABLE;
+    ibuf_desc.data.ptr = indices;
+    ibuf_desc.data.size = (size_t)num_indices * index_size;
+    ibuf_desc.label = "sgl-quad-index-buffer";
+    sg_buffer ibuf = sg_make_buffer(&ibuf_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != ibuf.id);
+    SOKOL_FREE(indices);
+    return ibuf;
+}
 
+/* create the sokol-gfx vertex buffer and static quad index buffer for num_vertices vertices */
+static void _sgl_make_gpu_buffers(_sgl_context_t* ctx, int num_vertices) {
     sg_buffer_desc vbuf_desc;
     memset(&vbuf_desc, 0, sizeof(vbuf_desc));
-    vbuf_desc.size = (size_t)_sgl.num_vertices * sizeof(_sgl_vertex_t);
+    vbuf_desc.size = (size_t)num_vertices * (size_t)ctx->vertex_size;
     vbuf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
     vbuf_desc.usage = SG_USAGE_STREAM;
     vbuf_desc.label = "sgl-vertex-buffer";
-    _sgl.vbuf = sg_make_buffer(&vbuf_desc);
-    SOKOL_ASSERT(SG_INVALID_ID != _sgl.vbuf.id);
+    ctx->vbuf = sg_make_buffer(&vbuf_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
+    ctx->vbuf_num_vertices = num_vertices;
+    ctx->quad_ibuf = _sgl_make_quad_index_buffer(ctx->quad_index_type, num_vertices);
+}
+
+static void _sgl_destroy_gpu_buffers(_sgl_context_t* ctx) {
+    sg_destroy_buffer(ctx->vbuf);
+    sg_destroy_buffer(ctx->quad_ibuf);
+    ctx->vbuf.id = SG_INVALID_ID;
+    ctx->quad_ibuf.id = SG_INVALID_ID;
+    ctx->vbuf_num_vertices = 0;
+}
+
+static void _sgl_init_context(_sgl_context_t* ctx, const sgl_context_desc_t* in_desc) {
+    SOKOL_ASSERT(ctx && (ctx->slot.state == SG_RESOURCESTATE_ALLOC) && in_desc);
+    ctx->desc = _sgl_context_desc_defaults(in_desc);
+
+    /* allocate buffers */
+    ctx->num_vertices = ctx->desc.max_vertices;
+    ctx->num_uniforms = ctx->desc.max_commands;
+    ctx->num_commands = ctx->num_uniforms;
+    ctx->vertices = (_sgl_vertex_t*) SOKOL_MALLOC((size_t)ctx->num_vertices * sizeof(_sgl_vertex_t));
+    SOKOL_ASSERT(ctx->vertices);
+    ctx->vertex_size = _sgl_vertex_size(ctx->desc.vertex_layout);
+    ctx->uniforms = (_sgl_uniform_t*) SOKOL_MALLOC((size_t)ctx->num_uniforms * sizeof(_sgl_uniform_t));
+    SOKOL_ASSERT(ctx->uniforms);
+    ctx->commands = (_sgl_command_t*) SOKOL_MALLOC((size_t)ctx->num_commands * sizeof(_sgl_command_t));
+    SOKOL_ASSERT(ctx->commands);
+
+    /* create sokol-gfx resource objects */
+    sg_push_debug_group("sokol-gl");
+
+    ctx->quad_index_type = (ctx->desc.grow_buffers || (ctx->num_vertices > (1<<16))) ? SG_INDEXTYPE_UINT32 : SG_INDEXTYPE_UINT16;
+    _sgl_make_gpu_buffers(ctx, ctx->num_vertices);
+
+    /* create default pipeline object */
+    sg_pipeline_desc def_pip_desc;
+    memset(&def_pip_desc, 0, sizeof(def_pip_desc));
+    def_pip_desc.depth.write_enabled = true;
+    ctx->def_pip = _sgl_make_pipeline(ctx, &def_pip_desc);
+    sg_pop_debug_group();
+
+    /* default state */
+    ctx->rgba = 0xFFFFFFFF;
+    ctx->cur_img = _sgl.def_img;
+    for (int i = 0; i < SGL_NUM_MATRIXMODES; i++) {
+        _sgl_identity(&ctx->matrix_stack[i][0]);
+    }
+    ctx->pip_stack[0] = ctx->def_pip;
+    ctx->line_width = 1.0f;
+    ctx->point_size = 1.0f;
+    ctx->aa_width = 1.0f;
+    ctx->matrix_dirty = true;
+    ctx->slot.state = SG_RESOURCESTATE_VALID;
+}
+
+static sgl_context _sgl_make_context(const sgl_context_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    sgl_context res = _sgl_make_ctx_id(SG_INVALID_ID);
+    int slot_index = _sgl_pool_alloc_index(&_sgl.context_pool.pool);
+    if (_SGL_INVALID_SLOT_INDEX != slot_index) {
+        _sgl_context_t* ctx = &_sgl.context_pool.contexts[slot_index];
+        res = _sgl_make_ctx_id(_sgl_slot_alloc(&_sgl.context_pool.pool, &ctx->slot, slot_index));
+        _sgl_init_context(ctx, desc);
+    }
+    else {
+        SOKOL_LOG("sokol_gl.h: context pool exhausted!");
+    }
+    return res;
+}
+
+static void _sgl_destroy_context(sgl_context ctx_id) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        SOKOL_FREE(ctx->vertices);
+        if (ctx->packed_vertices) {
+            SOKOL_FREE(ctx->packed_vertices);
+        }
+        SOKOL_FREE(ctx->uniforms);
+        SOKOL_FREE(ctx->commands);
+        sg_push_debug_group("sokol-gl");
+        _sgl_destroy_gpu_buffers(ctx);
+        _sgl_destroy_pipeline(ctx->def_pip);
+        sg_pop_debug_group();
+        memset(ctx, 0, sizeof(_sgl_context_t));
+        _sgl_pool_free_index(&_sgl.context_pool.pool, _sgl_slot_index(ctx_id.id));
+    }
+}
+
+static void _sgl_setup_list_pool(const sgl_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    /* note: the pools here will have an additional item, since slot 0 is reserved */
+    SOKOL_ASSERT((desc->list_pool_size > 0) && (desc->list_pool_size < _SGL_MAX_POOL_SIZE));
+    _sgl_init_pool(&_sgl.list_pool.pool, desc->list_pool_size);
+    size_t pool_byte_size = sizeof(_sgl_list_t) * (size_t)_sgl.list_pool.pool.size;
+    _sgl.list_pool.lists = (_sgl_list_t*) SOKOL_MALLOC(pool_byte_size);
+    SOKOL_ASSERT(_sgl.list_pool.lists);
+    memset(_sgl.list_pool.lists, 0, pool_byte_size);
+}
+
+static void _sgl_discard_list_pool(void) {
+    SOKOL_FREE(_sgl.list_pool.lists); _sgl.list_pool.lists = 0;
+    _sgl_discard_pool(&_sgl.list_pool.pool);
+}
+
+/* get display list pointer with id-check, returns 0 if no match */
+static _sgl_list_t* _sgl_lookup_list(uint32_t list_id) {
+    if (SG_INVALID_ID != list_id) {
+        int slot_index = _sgl_slot_index(list_id);
+        SOKOL_ASSERT((slot_index > _SGL_INVALID_SLOT_INDEX) && (slot_index < _sgl.list_pool.pool.size));
+        _sgl_list_t* list = &_sgl.list_pool.lists[slot_index];
+        if (list->slot.id == list_id) {
+            return list;
+        }
+    }
+    return 0;
+}
+
+/* make display list id from uint32_t id */
+static sgl_list _sgl_make_list_id(uint32_t list_id) {
+    sgl_list list;
+    list.id = list_id;
+    return list;
+}
+
+/* bake the vertices, uniforms and commands recorded since sgl_begin_list() into a display list */
+static sgl_list _sgl_make_list(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx && ctx->in_list);
+    sgl_list res = _sgl_make_list_id(SG_INVALID_ID);
+    int slot_index = _sgl_pool_alloc_index(&_sgl.list_pool.pool);
+    if (_SGL_INVALID_SLOT_INDEX == slot_index) {
+        SOKOL_LOG("sokol_gl.h: display list pool exhausted!");
+        return res;
+    }
+    _sgl_list_t* list = &_sgl.list_pool.lists[slot_index];
+    res = _sgl_make_list_id(_sgl_slot_alloc(&_sgl.list_pool.pool, &list->slot, slot_index));
+    list->ctx.id = ctx->slot.id;
+    list->num_vertices = ctx->cur_vertex - ctx->list_base_vertex;
+    list->num_uniforms = ctx->cur_uniform - ctx->list_base_uniform;
+    list->num_commands = ctx->cur_command - ctx->list_base_command;
+    if (list->num_uniforms > 0) {
+        const size_t uniforms_size = (size_t)list->num_uniforms * sizeof(_sgl_uniform_t);
+        list->uniforms = (_sgl_uniform_t*) SOKOL_MALLOC(uniforms_size);
+        SOKOL_ASSERT(list->uniforms);
+        memcpy(list->uniforms, &ctx->uniforms[ctx->list_base_uniform], uniforms_size);
+    }
+    bool has_quads = false;
+    bool has_thick = false;
+    if (list->num_commands > 0) {
+        const size_t commands_size = (size_t)list->num_commands * sizeof(_sgl_command_t);
+        list->commands = (_sgl_command_t*) SOKOL_MALLOC(commands_size);
+        SOKOL_ASSERT(list->commands);
+        memcpy(list->commands, &ctx->commands[ctx->list_base_command], commands_size);
+        for (int i = 0; i < list->num_commands; i++) {
+            _sgl_command_t* cmd = &list->commands[i];
+            if (cmd->cmd == SGL_COMMAND_DRAW) {
+                /* list_base_vertex is a multiple of 4, so quads stay aligned */
+                cmd->args.draw.base_vertex -= ctx->list_base_vertex;
+                cmd->args.draw.uniform_index -= ctx->list_base_uniform;
+                has_quads |= cmd->args.draw.indexed;
+                has_thick |= cmd->args.draw.vertices_per_instance > 0;
+            }
+        }
+    }
+    if (has_thick && (list->num_uniforms > 0)) {
+        /* remember which uniform blocks carry thick line parameters instead of a texture matrix */
+        list->thick_uniforms = (bool*) SOKOL_MALLOC((size_t)list->num_uniforms * sizeof(bool));
+        SOKOL_ASSERT(list->thick_uniforms);
+        memset(list->thick_uniforms, 0, (size_t)list->num_uniforms * sizeof(bool));
+        for (int i = 0; i < list->num_commands; i++) {
+            const _sgl_command_t* cmd = &list->commands[i];
+            if ((cmd->cmd == SGL_COMMAND_DRAW) && (cmd->args.draw.vertices_per_instance > 0)) {
+                list->thick_uniforms[cmd->args.draw.uniform_index] = true;
+            }
+        }
+    }
+    sg_push_debug_group("sokol-gl");
+    if (list->num_vertices > 0) {
+        const _sgl_vertex_t* src = &ctx->vertices[ctx->list_base_vertex];
+        sg_buffer_desc vbuf_desc;
+        memset(&vbuf_desc, 0, sizeof(vbuf_desc));
+        vbuf_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+        vbuf_desc.usage = SG_USAGE_IMMUTABLE;
+        vbuf_desc.data.ptr = src;
+        vbuf_desc.data.size = (size_t)list->num_vertices * (size_t)ctx->vertex_size;
+        vbuf_desc.label = "sgl-list-vertex-buffer";
+        void* packed = 0;
+        if (ctx->desc.vertex_layout != SGL_VERTEXLAYOUT_POS3_UV2_COLOR) {
+            packed = SOKOL_MALLOC(vbuf_desc.data.size);
+            SOKOL_ASSERT(packed);
+            _sgl_pack_vertices(packed, src, list->num_vertices, ctx->desc.vertex_layout);
+            vbuf_desc.data.ptr = packed;
+        }
+        list->vbuf = sg_make_buffer(&vbuf_desc);
+        SOKOL_ASSERT(SG_INVALID_ID != list->vbuf.id);
+        if (packed) {
+            SOKOL_FREE(packed);
+        }
+        if (has_quads || has_thick) {
+            /* thick lines and round points need at least one quad */
+            list->quad_ibuf = _sgl_make_quad_index_buffer(ctx->quad_index_type, (list->num_vertices > 4) ? list->num_vertices : 4);
+        }
+    }
+    sg_pop_debug_group();
+    list->slot.state = SG_RESOURCESTATE_VALID;
+    return res;
+}
+
+static void _sgl_destroy_list(sgl_list list_id) {
+    _sgl_list_t* list = _sgl_lookup_list(list_id.id);
+    if (list) {
+        sg_push_debug_group("sokol-gl");
+        sg_destroy_buffer(list->vbuf);
+        sg_destroy_buffer(list->quad_ibuf);
+        sg_pop_debug_group();
+        if (list->uniforms) {
+            SOKOL_FREE(list->uniforms);
+        }
+        if (list->commands) {
+            SOKOL_FREE(list->commands);
+        }
+        if (list->thick_uniforms) {
+            SOKOL_FREE(list->thick_uniforms);
+        }
+        memset(list, 0, sizeof(_sgl_list_t));
+        _sgl_pool_free_index(&_sgl.list_pool.pool, _sgl_slot_index(list_id.id));
+    }
+}
+
+/*
+    Execute a range of recorded commands, either the commands of a
+    context or of a display list (with its own vertex- and quad-index-
+    buffer), uniform_base is added to the uniform index of draw commands.
+*/
+static void _sgl_exec_commands(_sgl_context_t* ctx, const _sgl_command_t* cmds, int num_cmds, int uniform_base, sg_buffer vbuf, sg_buffer quad_ibuf) {
+    uint32_t cur_pip_id = SG_INVALID_ID;
+    uint32_t cur_img_id = SG_INVALID_ID;
+    int cur_uniform_index = -1;
+    sg_bindings bind;
+    memset(&bind, 0, sizeof(bind));
+    bind.vertex_buffers[0] = vbuf;
+    for (int i = 0; i < num_cmds; i++) {
+        const _sgl_command_t* cmd = &cmds[i];
+        switch (cmd->cmd) {
+            case SGL_COMMAND_VIEWPORT:
+                {
+                    const _sgl_viewport_args_t* args = &cmd->args.viewport;
+                    sg_apply_viewport(args->x, args->y, args->w, args->h, args->origin_top_left);
+                }
+                break;
+            case SGL_COMMAND_SCISSOR_RECT:
+                {
+                    const _sgl_scissor_rect_args_t* args = &cmd->args.scissor_rect;
+                    sg_apply_scissor_rect(args->x, args->y, args->w, args->h, args->origin_top_left);
+                }
+                break;
+            case SGL_COMMAND_DRAW:
+                {
+                    const _sgl_draw_args_t* args = &cmd->args.draw;
+                    const int uniform_index = uniform_base + args->uniform_index;
+                    if (args->pip.id != cur_pip_id) {
+                        sg_apply_pipeline(args->pip);
+                        cur_pip_id = args->pip.id;
+                        /* when pipeline changes, also need to re-apply uniforms and bindings */
+                        cur_img_id = SG_INVALID_ID;
+                        cur_uniform_index = -1;
+                    }
+                    if (args->vertices_per_instance > 0) {
+                        /*
+                            thick lines and round points read their recorded vertices as
+                            per-instance data starting at the draw's base vertex, and expand
+                            them to an indexed quad through the per-vertex corner buffer
+                        */
+                        bind.vertex_buffer_offsets[0] = args->base_vertex * ctx->vertex_size;
+                        bind.vertex_buffers[1] = _sgl.corner_vbuf;
+                        bind.index_buffer = quad_ibuf;
+                        bind.fs_images[0] = args->img;
+                        sg_apply_bindings(&bind);
+                        bind.vertex_buffer_offsets[0] = 0;
+                        bind.vertex_buffers[1].id = SG_INVALID_ID;
+                        cur_img_id = SG_INVALID_ID;
+                    }
+                    else if (cur_img_id != args->img.id) {
+                        /* quad pipelines expect an index buffer, all others must not have one */
+                        if (args->indexed) {
+                            bind.index_buffer = quad_ibuf;
+                        }
+                        else {
+                            bind.index_buffer.id = SG_INVALID_ID;
+                        }
+                        bind.fs_images[0] = args->img;
+                        sg_apply_bindings(&bind);
+                        cur_img_id = args->img.id;
+                    }
+                    if (cur_uniform_index != uniform_index) {
+                        const sg_range ub_range = { &ctx->uniforms[uniform_index], sizeof(_sgl_uniform_t) };
+                        sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &ub_range);
+                        cur_uniform_index = uniform_index;
+                        ctx->stats.num_apply_uniforms++;
+                    }
+                    /* FIXME: what if number of vertices doesn't match the primitive type? */
+                    if (args->num_vertices > 0) {
+                        if (args->vertices_per_instance > 0) {
+                            sg_draw(0, 6, args->num_vertices / args->vertices_per_instance);
+                        }
+                        else if (args->indexed) {
+                            /* 6 indices per quad, base_vertex is a multiple of 4 */
+                            sg_draw((args->base_vertex / 4) * 6, (args->num_vertices / 4) * 6, 1);
+                        }
+                        else {
+                            sg_draw(args->base_vertex, args->num_vertices, 1);
+                        }
+                        ctx->stats.num_draws++;
+                    }
+                }
+                break;
+            case SGL_COMMAND_CALL_LIST:
+                {
+                    const _sgl_call_list_args_t* args = &cmd->args.call_list;
+                    const _sgl_list_t* list = _sgl_lookup_list(args->list.id);
+                    if (list) {
+                        _sgl_exec_commands(ctx, list->commands, list->num_commands, args->uniform_index, list->vbuf, list->quad_ibuf);
+                        /* the list has changed the pipeline, bindings and uniforms */
+                        cur_pip_id = SG_INVALID_ID;
+                        cur_img_id = SG_INVALID_ID;
+                        cur_uniform_index = -1;
+                    }
+                }
+                break;
+        }
+    }
+}
+
+/* this renders the accumulated draw commands of a context via sokol-gfx */
+static void _sgl_draw(_sgl_context_t* ctx) {
+    SOKOL_ASSERT(ctx && !ctx->in_list);
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+    if (ctx->cur_vertex > ctx->peak_vertices) {
+        ctx->peak_vertices = ctx->cur_vertex;
+    }
+    if (ctx->cur_command > ctx->peak_commands) {
+        ctx->peak_commands = ctx->cur_command;
+    }
+    if (ctx->cur_uniform > ctx->peak_uniforms) {
+        ctx->peak_uniforms = ctx->cur_uniform;
+    }
+    ctx->stats.num_begin_end = ctx->num_begin_end;
+    ctx->stats.num_vertices = ctx->cur_vertex;
+    ctx->stats.peak_vertices = ctx->peak_vertices;
+    ctx->stats.peak_commands = ctx->peak_commands;
+    ctx->stats.peak_uniforms = ctx->peak_uniforms;
+    if ((ctx->error == SGL_NO_ERROR) && (ctx->cur_command > 0)) {
+        sg_push_debug_group("sokol-gl");
+        if (ctx->cur_vertex > 0) {
+            if (ctx->cur_vertex > ctx->vbuf_num_vertices) {
+                /* the CPU-side vertex buffer has grown, recreate the GPU buffers to match */
+                SOKOL_ASSERT(ctx->desc.grow_buffers);
+                _sgl_destroy_gpu_buffers(ctx);
+                _sgl_make_gpu_buffers(ctx, ctx->num_vertices);
+            }
+            sg_range range = { ctx->vertices, (size_t)ctx->cur_vertex * (size_t)ctx->vertex_size };
+            if (ctx->desc.vertex_layout != SGL_VERTEXLAYOUT_POS3_UV2_COLOR) {
+                /* convert to the compact vertex layout in a staging buffer */
+                if (ctx->num_packed_vertices < ctx->cur_vertex) {
+                    if (ctx->packed_vertices) {
+                        SOKOL_FREE(ctx->packed_vertices);
+                    }
+                    ctx->num_packed_vertices = ctx->num_vertices;
+                    ctx->packed_vertices = SOKOL_MALLOC((size_t)ctx->num_packed_vertices * (size_t)ctx->vertex_size);
+                    SOKOL_ASSERT(ctx->packed_vertices);
+                }
+                _sgl_pack_vertices(ctx->packed_vertices, ctx->vertices, ctx->cur_vertex, ctx->desc.vertex_layout);
+                range.ptr = ctx->packed_vertices;
+            }
+            sg_update_buffer(ctx->vbuf, &range);
+        }
+        _sgl_exec_commands(ctx, ctx->commands, ctx->cur_command, 0, ctx->vbuf, ctx->quad_ibuf);
+        sg_pop_debug_group();
+    }
+    _sgl_rewind(ctx);
+}
+
+/*== PUBLIC FUNCTIONS ========================================================*/
+SOKOL_API_IMPL void sgl_setup(const sgl_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    memset(&_sgl, 0, sizeof(_sgl));
+    _sgl.init_cookie = _SGL_INIT_COOKIE;
+    _sgl.desc = *desc;
+    _sgl.desc.pipeline_pool_size = _sgl_def(_sgl.desc.pipeline_pool_size, _SGL_DEFAULT_PIPELINE_POOL_SIZE);
+    _sgl.desc.context_pool_size = _sgl_def(_sgl.desc.context_pool_size, _SGL_DEFAULT_CONTEXT_POOL_SIZE);
+    _sgl.desc.list_pool_size = _sgl_def(_sgl.desc.list_pool_size, _SGL_DEFAULT_LIST_POOL_SIZE);
+    _sgl.desc.max_vertices = _sgl_def(_sgl.desc.max_vertices, _SGL_DEFAULT_MAX_VERTICES);
+    _sgl.desc.max_commands = _sgl_def(_sgl.desc.max_commands, _SGL_DEFAULT_MAX_COMMANDS);
+    _sgl.desc.face_winding = _sgl_def(_sgl.desc.face_winding, SG_FACEWINDING_CCW);
+
+    /* allocate pools */
+    _sgl_setup_pipeline_pool(&_sgl.desc);
+    _sgl_setup_context_pool(&_sgl.desc);
+    _sgl_setup_list_pool(&_sgl.desc);
+
+    /* create shared sokol-gfx resource objects */
+    sg_push_debug_group("sokol-gl");
 
     uint32_t pixels[64];
     for (int i = 0; i < 64; i++) {
@@ -2693,7 +4251,6 @@ SOKOL_API_IMPL void sgl_setup(const sgl_desc_t* desc) {
     img_desc.label = "sgl-default-texture";
     _sgl.def_img = sg_make_image(&img_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sgl.def_img.id);
-    _sgl.cur_img = _sgl.def_img;
 
     sg_shader_desc shd_desc;
     memset(&shd_desc, 0, sizeof(shd_desc));
@@ -2745,48 +4302,193 @@ SOKOL_API_IMPL void sgl_setup(const sgl_desc_t* desc) {
         shd_desc.vs.bytecode = SG_RANGE(_sgl_vs_bytecode_wgpu);
         shd_desc.fs.bytecode = SG_RANGE(_sgl_fs_bytecode_wgpu);
     #else
-        shd_desc.vs.source = _sgl_vs_src_dummy;
-        shd_desc.fs.source = _sgl_fs_src_dummy;
+        shd_desc.vs.source = _sgl_vs_source_dummy;
+        shd_desc.fs.source = _sgl_fs_source_dummy;
     #endif
     _sgl.shd = sg_make_shader(&shd_desc);
     SOKOL_ASSERT(SG_INVALID_ID != _sgl.shd.id);
 
-    /* create default pipeline object */
-    sg_pipeline_desc def_pip_desc;
-    memset(&def_pip_desc, 0, sizeof(def_pip_desc));
-    def_pip_desc.depth.write_enabled = true;
-    _sgl.def_pip = _sgl_make_pipeline(&def_pip_desc);
+    /* shader and corner buffer for GPU-expanded thick lines and round points (requires instancing) */
+    #if !defined(SOKOL_WGPU)
+    if (sg_query_features().instancing) {
+        sg_shader_desc thick_shd_desc;
+        memset(&thick_shd_desc, 0, sizeof(thick_shd_desc));
+        static const char* thick_attr_names[7] = {
+            "position0", "texcoord0", "color0", "position1", "texcoord1", "color1", "corner"
+        };
+        for (int i = 0; i < 7; i++) {
+            thick_shd_desc.attrs[i].name = thick_attr_names[i];
+            thick_shd_desc.attrs[i].sem_name = "TEXCOORD";
+            thick_shd_desc.attrs[i].sem_index = i;
+        }
+        thick_shd_desc.vs.uniform_blocks[0] = shd_desc.vs.uniform_blocks[0];
+        thick_shd_desc.fs.images[0] = shd_desc.fs.images[0];
+        thick_shd_desc.label = "sgl-thick-shader";
+        #if defined(SOKOL_GLCORE33)
+            thick_shd_desc.vs.source = _sgl_thick_vs_source_glsl330;
+            thick_shd_desc.fs.source = _sgl_thick_fs_source_glsl330;
+        #elif defined(SOKOL_GLES2) || defined(SOKOL_GLES3)
+            thick_shd_desc.vs.source = _sgl_thick_vs_source_glsl100;
+            thick_shd_desc.fs.source = _sgl_thick_fs_source_glsl100;
+        #elif defined(SOKOL_METAL)
+            thick_shd_desc.vs.entry = "main0";
+            thick_shd_desc.fs.entry = "main0";
+            thick_shd_desc.vs.source = _sgl_thick_vs_source_metal;
+            thick_shd_desc.fs.source = _sgl_thick_fs_source_metal;
+        #elif defined(SOKOL_D3D11)
+            thick_shd_desc.vs.source = _sgl_thick_vs_source_hlsl4;
+            thick_shd_desc.fs.source = _sgl_thick_fs_source_hlsl4;
+        #else
+            thick_shd_desc.vs.source = _sgl_thick_vs_source_dummy;
+            thick_shd_desc.fs.source = _sgl_thick_fs_source_dummy;
+        #endif
+        _sgl.thick_shd = sg_make_shader(&thick_shd_desc);
+        if (SG_RESOURCESTATE_VALID != sg_query_shader_state(_sgl.thick_shd)) {
+            /* the shader source failed to compile (e.g. no D3D shader compiler available) */
+            sg_destroy_shader(_sgl.thick_shd);
+            _sgl.thick_shd.id = SG_INVALID_ID;
+        }
+        if (SG_INVALID_ID != _sgl.thick_shd.id) {
+            /* x: segment start (0) or end (1), y: side */
+            static const float corners[8] = { 0.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+            sg_buffer_desc corner_desc;
+            memset(&corner_desc, 0, sizeof(corner_desc));
+            corner_desc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+            corner_desc.usage = SG_USAGE_IMMUTABLE;
+            corner_desc.data = SG_RANGE(corners);
+            corner_desc.label = "sgl-corner-buffer";
+            _sgl.corner_vbuf = sg_make_buffer(&corner_desc);
+            SOKOL_ASSERT(SG_INVALID_ID != _sgl.corner_vbuf.id);
+        }
+        else {
+            SOKOL_LOG("sokol_gl.h: failed to create thick line shader, falling back to regular lines and points");
+        }
+    }
+    #endif
     sg_pop_debug_group();
 
-    /* default state */
-    _sgl.rgba = 0xFFFFFFFF;
-    for (int i = 0; i < SGL_NUM_MATRIXMODES; i++) {
-        _sgl_identity(&_sgl.matrix_stack[i][0]);
-    }
-    _sgl.pip_stack[0] = _sgl.def_pip;
-    _sgl.matrix_dirty = true;
+    /* create the default context */
+    sgl_context_desc_t def_ctx_desc;
+    memset(&def_ctx_desc, 0, sizeof(def_ctx_desc));
+    def_ctx_desc.max_vertices = _sgl.desc.max_vertices;
+    def_ctx_desc.max_commands = _sgl.desc.max_commands;
+    def_ctx_desc.color_format = _sgl.desc.color_format;
+    def_ctx_desc.depth_format = _sgl.desc.depth_format;
+    def_ctx_desc.sample_count = _sgl.desc.sample_count;
+    def_ctx_desc.cpu_transform = _sgl.desc.cpu_transform;
+    def_ctx_desc.grow_buffers = _sgl.desc.grow_buffers;
+    def_ctx_desc.vertex_layout = _sgl.desc.vertex_layout;
+    _sgl.def_ctx_id = _sgl_make_context(&def_ctx_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != _sgl.def_ctx_id.id);
+    _sgl_cur_ctx_id = _sgl_make_ctx_id(SG_INVALID_ID);
 }
 
 SOKOL_API_IMPL void sgl_shutdown(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_FREE(_sgl.vertices); _sgl.vertices = 0;
-    SOKOL_FREE(_sgl.uniforms); _sgl.uniforms = 0;
-    SOKOL_FREE(_sgl.commands); _sgl.commands = 0;
+    for (int i = 0; i < _sgl.list_pool.pool.size; i++) {
+        _sgl_list_t* list = &_sgl.list_pool.lists[i];
+        _sgl_destroy_list(_sgl_make_list_id(list->slot.id));
+    }
+    for (int i = 0; i < _sgl.context_pool.pool.size; i++) {
+        _sgl_context_t* ctx = &_sgl.context_pool.contexts[i];
+        _sgl_destroy_context(_sgl_make_ctx_id(ctx->slot.id));
+    }
     sg_push_debug_group("sokol-gl");
-    sg_destroy_buffer(_sgl.vbuf);
     sg_destroy_image(_sgl.def_img);
     sg_destroy_shader(_sgl.shd);
+    sg_destroy_shader(_sgl.thick_shd);
+    sg_destroy_buffer(_sgl.corner_vbuf);
     for (int i = 0; i < _sgl.pip_pool.pool.size; i++) {
         _sgl_pipeline_t* pip = &_sgl.pip_pool.pips[i];
         _sgl_destroy_pipeline(_sgl_make_pip_id(pip->slot.id));
     }
     sg_pop_debug_group();
+    _sgl_discard_list_pool();
+    _sgl_discard_context_pool();
     _sgl_discard_pipeline_pool();
+    _sgl_cur_ctx_id = _sgl_make_ctx_id(SG_INVALID_ID);
     _sgl.init_cookie = 0;
 }
 
+SOKOL_API_IMPL sgl_context sgl_make_context(const sgl_context_desc_t* desc) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    return _sgl_make_context(desc);
+}
+
+SOKOL_API_IMPL void sgl_destroy_context(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    if (ctx_id.id == _sgl.def_ctx_id.id) {
+        SOKOL_LOG("sokol_gl.h: cannot destroy default context");
+        return;
+    }
+    if (ctx_id.id == _sgl_cur_ctx_id.id) {
+        _sgl_cur_ctx_id = _sgl_make_ctx_id(SG_INVALID_ID);
+    }
+    _sgl_destroy_context(ctx_id);
+}
+
+SOKOL_API_IMPL void sgl_set_context(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_cur_ctx_id = ctx_id;
+}
+
+SOKOL_API_IMPL sgl_context sgl_get_context(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    if (SG_INVALID_ID != _sgl_cur_ctx_id.id) {
+        return _sgl_cur_ctx_id;
+    }
+    else {
+        return _sgl.def_ctx_id;
+    }
+}
+
+SOKOL_API_IMPL sgl_context sgl_default_context(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    return _sgl.def_ctx_id;
+}
+
 SOKOL_API_IMPL sgl_error_t sgl_error(void) {
-    return _sgl.error;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        return ctx->error;
+    }
+    else {
+        return SGL_ERROR_NO_CONTEXT;
+    }
+}
+
+SOKOL_API_IMPL sgl_error_t sgl_context_error(sgl_context ctx_id) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        return ctx->error;
+    }
+    else {
+        return SGL_ERROR_NO_CONTEXT;
+    }
+}
+
+SOKOL_API_IMPL sgl_stats_t sgl_stats(void) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        return ctx->stats;
+    }
+    else {
+        sgl_stats_t res;
+        memset(&res, 0, sizeof(res));
+        return res;
+    }
+}
+
+SOKOL_API_IMPL sgl_stats_t sgl_context_stats(sgl_context ctx_id) {
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        return ctx->stats;
+    }
+    else {
+        sgl_stats_t res;
+        memset(&res, 0, sizeof(res));
+        return res;
+    }
 }
 
 SOKOL_API_IMPL float sgl_rad(float deg) {
@@ -2799,7 +4501,24 @@ SOKOL_API_IMPL float sgl_deg(float rad) {
 
 SOKOL_API_IMPL sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    return _sgl_make_pipeline(desc);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        return _sgl_make_pipeline(ctx, desc);
+    }
+    else {
+        return _sgl_make_pip_id(SG_INVALID_ID);
+    }
+}
+
+SOKOL_API_IMPL sgl_pipeline sgl_context_make_pipeline(sgl_context ctx_id, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        return _sgl_make_pipeline(ctx, desc);
+    }
+    else {
+        return _sgl_make_pip_id(SG_INVALID_ID);
+    }
 }
 
 SOKOL_API_IMPL void sgl_destroy_pipeline(sgl_pipeline pip_id) {
@@ -2809,63 +4528,93 @@ SOKOL_API_IMPL void sgl_destroy_pipeline(sgl_pipeline pip_id) {
 
 SOKOL_API_IMPL void sgl_load_pipeline(sgl_pipeline pip_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT((_sgl.pip_tos >= 0) && (_sgl.pip_tos < _SGL_MAX_STACK_DEPTH));
-    _sgl.pip_stack[_sgl.pip_tos] = pip_id;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT((ctx->pip_tos >= 0) && (ctx->pip_tos < _SGL_MAX_STACK_DEPTH));
+        #if defined(SOKOL_DEBUG)
+        {
+            /* pipelines can only be used in the context they were created for */
+            const _sgl_pipeline_t* pip = _sgl_lookup_pipeline(pip_id.id);
+            SOKOL_ASSERT(!pip || (pip->ctx.id == ctx->slot.id));
+        }
+        #endif
+        ctx->pip_stack[ctx->pip_tos] = pip_id;
+    }
 }
 
 SOKOL_API_IMPL void sgl_default_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT((_sgl.pip_tos >= 0) && (_sgl.pip_tos < _SGL_MAX_STACK_DEPTH));
-    _sgl.pip_stack[_sgl.pip_tos] = _sgl.def_pip;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT((ctx->pip_tos >= 0) && (ctx->pip_tos < _SGL_MAX_STACK_DEPTH));
+        ctx->pip_stack[ctx->pip_tos] = ctx->def_pip;
+    }
 }
 
 SOKOL_API_IMPL void sgl_push_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    if (_sgl.pip_tos < (_SGL_MAX_STACK_DEPTH - 1)) {
-        _sgl.pip_tos++;
-        _sgl.pip_stack[_sgl.pip_tos] = _sgl.pip_stack[_sgl.pip_tos-1];
-    }
-    else {
-        _sgl.error = SGL_ERROR_STACK_OVERFLOW;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        if (ctx->pip_tos < (_SGL_MAX_STACK_DEPTH - 1)) {
+            ctx->pip_tos++;
+            ctx->pip_stack[ctx->pip_tos] = ctx->pip_stack[ctx->pip_tos-1];
+        }
+        else {
+            ctx->error = SGL_ERROR_STACK_OVERFLOW;
+        }
     }
 }
 
 SOKOL_API_IMPL void sgl_pop_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    if (_sgl.pip_tos > 0) {
-        _sgl.pip_tos--;
-    }
-    else {
-        _sgl.error = SGL_ERROR_STACK_UNDERFLOW;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        if (ctx->pip_tos > 0) {
+            ctx->pip_tos--;
+        }
+        else {
+            ctx->error = SGL_ERROR_STACK_UNDERFLOW;
+        }
     }
 }
 
 SOKOL_API_IMPL void sgl_defaults(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl.u = 0.0f; _sgl.v = 0.0f;
-    _sgl.rgba = 0xFFFFFFFF;
-    _sgl.texturing_enabled = false;
-    _sgl.cur_img = _sgl.def_img;
-    sgl_default_pipeline();
-    _sgl_identity(_sgl_matrix_texture());
-    _sgl_identity(_sgl_matrix_modelview());
-    _sgl_identity(_sgl_matrix_projection());
-    _sgl.cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
-    _sgl.matrix_dirty = true;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        ctx->u = 0.0f; ctx->v = 0.0f;
+        ctx->rgba = 0xFFFFFFFF;
+        ctx->texturing_enabled = false;
+        ctx->cur_img = _sgl.def_img;
+        ctx->line_width = 1.0f;
+        ctx->point_size = 1.0f;
+        ctx->aa_width = 1.0f;
+        sgl_default_pipeline();
+        _sgl_identity(_sgl_matrix_texture(ctx));
+        _sgl_identity(_sgl_matrix_modelview(ctx));
+        _sgl_identity(_sgl_matrix_projection(ctx));
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
+        ctx->matrix_dirty = true;
+    }
 }
 
 SOKOL_API_IMPL void sgl_viewport(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_command_t* cmd = _sgl_next_command();
-    if (cmd) {
-        cmd->cmd = SGL_COMMAND_VIEWPORT;
-        cmd->args.viewport.x = x;
-        cmd->args.viewport.y = y;
-        cmd->args.viewport.w = w;
-        cmd->args.viewport.h = h;
-        cmd->args.viewport.origin_top_left = origin_top_left;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        ctx->viewport_w = (float)w;
+        ctx->viewport_h = (float)h;
+        _sgl_command_t* cmd = _sgl_next_command(ctx);
+        if (cmd) {
+            cmd->cmd = SGL_COMMAND_VIEWPORT;
+            cmd->args.viewport.x = x;
+            cmd->args.viewport.y = y;
+            cmd->args.viewport.w = w;
+            cmd->args.viewport.h = h;
+            cmd->args.viewport.origin_top_left = origin_top_left;
+        }
     }
 }
 
@@ -2875,15 +4624,18 @@ SOKOL_API_IMPL void sgl_viewportf(float x, float y, float w, float h, bool origi
 
 SOKOL_API_IMPL void sgl_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_command_t* cmd = _sgl_next_command();
-    if (cmd) {
-        cmd->cmd = SGL_COMMAND_SCISSOR_RECT;
-        cmd->args.scissor_rect.x = x;
-        cmd->args.scissor_rect.y = y;
-        cmd->args.scissor_rect.w = w;
-        cmd->args.scissor_rect.h = h;
-        cmd->args.scissor_rect.origin_top_left = origin_top_left;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_command_t* cmd = _sgl_next_command(ctx);
+        if (cmd) {
+            cmd->cmd = SGL_COMMAND_SCISSOR_RECT;
+            cmd->args.scissor_rect.x = x;
+            cmd->args.scissor_rect.y = y;
+            cmd->args.scissor_rect.w = w;
+            cmd->args.scissor_rect.h = h;
+            cmd->args.scissor_rect.origin_top_left = origin_top_left;
+        }
     }
 }
 
@@ -2893,405 +4645,763 @@ SOKOL_API_IMPL void sgl_scissor_rectf(float x, float y, float w, float h, bool o
 
 SOKOL_API_IMPL void sgl_enable_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl.texturing_enabled = true;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        ctx->texturing_enabled = true;
+    }
 }
 
 SOKOL_API_IMPL void sgl_disable_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl.texturing_enabled = false;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        ctx->texturing_enabled = false;
+    }
 }
 
 SOKOL_API_IMPL void sgl_texture(sg_image img) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    if (SG_INVALID_ID != img.id) {
-        _sgl.cur_img = img;
-    }
-    else {
-        _sgl.cur_img = _sgl.def_img;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        if (SG_INVALID_ID != img.id) {
+            ctx->cur_img = img;
+        }
+        else {
+            ctx->cur_img = _sgl.def_img;
+        }
     }
 }
 
 SOKOL_API_IMPL void sgl_begin_points(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_POINTS);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_POINTS);
+    }
+}
+
+SOKOL_API_IMPL void sgl_begin_round_points(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_ROUND_POINTS);
+    }
+}
+
+SOKOL_API_IMPL void sgl_begin_thick_lines(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_THICK_LINES);
+    }
 }
 
 SOKOL_API_IMPL void sgl_begin_lines(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_LINES);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINES);
+    }
 }
 
 SOKOL_API_IMPL void sgl_begin_line_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_LINE_STRIP);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_LINE_STRIP);
+    }
 }
 
 SOKOL_API_IMPL void sgl_begin_triangles(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_TRIANGLES);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLES);
+    }
 }
 
 SOKOL_API_IMPL void sgl_begin_triangle_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_TRIANGLE_STRIP);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_TRIANGLE_STRIP);
+    }
 }
 
 SOKOL_API_IMPL void sgl_begin_quads(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(!_sgl.in_begin);
-    _sgl_begin(SGL_PRIMITIVETYPE_QUADS);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        _sgl_begin(ctx, SGL_PRIMITIVETYPE_QUADS);
+    }
 }
 
 SOKOL_API_IMPL void sgl_end(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT(_sgl.in_begin);
-    SOKOL_ASSERT(_sgl.cur_vertex >= _sgl.base_vertex);
-    _sgl.in_begin = false;
-    bool matrix_dirty = _sgl.matrix_dirty;
-    if (matrix_dirty) {
-        _sgl.matrix_dirty = false;
-        _sgl_uniform_t* uni = _sgl_next_uniform();
-        if (uni) {
-            _sgl_matmul4(&uni->mvp, _sgl_matrix_projection(), _sgl_matrix_modelview());
-            uni->tm = *_sgl_matrix_texture();
-        }
-    }
-    /* check if command can be merged with previous command */
-    sg_pipeline pip = _sgl_get_pipeline(_sgl.pip_stack[_sgl.pip_tos], _sgl.cur_prim_type);
-    sg_image img = _sgl.texturing_enabled ? _sgl.cur_img : _sgl.def_img;
-    _sgl_command_t* prev_cmd = _sgl_prev_command();
-    bool merge_cmd = false;
-    if (prev_cmd) {
-        if ((prev_cmd->cmd == SGL_COMMAND_DRAW) &&
-            (_sgl.cur_prim_type != SGL_PRIMITIVETYPE_LINE_STRIP) &&
-            (_sgl.cur_prim_type != SGL_PRIMITIVETYPE_TRIANGLE_STRIP) &&
-            !matrix_dirty &&
-            (prev_cmd->args.draw.img.id == img.id) &&
-            (prev_cmd->args.draw.pip.id == pip.id))
-        {
-            merge_cmd = true;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(ctx->in_begin);
+        SOKOL_ASSERT(ctx->cur_vertex >= ctx->base_vertex);
+        ctx->in_begin = false;
+        if (_sgl_is_thick(ctx->cur_prim_type) && ((ctx->viewport_w <= 0.0f) || (ctx->viewport_h <= 0.0f))) {
+            /* pixel sizes can't be computed without the viewport size */
+            if (!ctx->viewport_warned) {
+                SOKOL_LOG("sokol_gl.h: thick lines and round points require sgl_viewport(), falling back to regular lines and points");
+                ctx->viewport_warned = true;
+            }
+            ctx->cur_prim_type = (SGL_PRIMITIVETYPE_THICK_LINES == ctx->cur_prim_type) ? SGL_PRIMITIVETYPE_LINES : SGL_PRIMITIVETYPE_POINTS;
+        }
+        if (_sgl_is_thick(ctx->cur_prim_type) && (SG_INVALID_ID == _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type).id)) {
+            /* GPU-expanded primitives not supported by pipeline or backend, fall back to regular lines or points */
+            ctx->cur_prim_type = (SGL_PRIMITIVETYPE_THICK_LINES == ctx->cur_prim_type) ? SGL_PRIMITIVETYPE_LINES : SGL_PRIMITIVETYPE_POINTS;
+        }
+        const bool indexed = (SGL_PRIMITIVETYPE_QUADS == ctx->cur_prim_type);
+        const bool thick = _sgl_is_thick(ctx->cur_prim_type);
+        int vertices_per_instance = 0;
+        if (indexed) {
+            /* drop an incomplete trailing quad */
+            ctx->cur_vertex = ctx->base_vertex + ((ctx->cur_vertex - ctx->base_vertex) & ~3);
+        }
+        else if (SGL_PRIMITIVETYPE_THICK_LINES == ctx->cur_prim_type) {
+            /* drop an incomplete trailing line segment */
+            ctx->cur_vertex = ctx->base_vertex + ((ctx->cur_vertex - ctx->base_vertex) & ~1);
+            vertices_per_instance = 2;
+        }
+        else if (SGL_PRIMITIVETYPE_ROUND_POINTS == ctx->cur_prim_type) {
+            vertices_per_instance = 1;
+        }
+        ctx->num_begin_end++;
+        /* a projective model-view matrix can't be applied on the CPU, use the GPU transform instead */
+        const bool cpu_transform = ctx->desc.cpu_transform && _sgl_is_affine(_sgl_matrix_modelview(ctx));
+        if (cpu_transform) {
+            /* model-view and texture matrix are applied here, only projection goes to the GPU */
+            _sgl_transform_vertices(&ctx->vertices[ctx->base_vertex],
+                ctx->cur_vertex - ctx->base_vertex,
+                _sgl_matrix_modelview(ctx),
+                _sgl_matrix_texture(ctx));
+        }
+        /* model-view changes don't set matrix_dirty in CPU transform mode, so the
+           uniform content must be compared when falling back to the GPU transform
+        */
+        const bool compare_uniform = thick || (ctx->desc.cpu_transform && !cpu_transform);
+        bool new_uniform = ctx->matrix_dirty || (thick != ctx->thick_uniform) || (cpu_transform != ctx->cpu_uniform);
+        _sgl_uniform_t uni_data;
+        if (new_uniform || compare_uniform) {
+            /* in display lists, the projection matrix is applied in sgl_call_list() */
+            const _sgl_matrix_t* proj = _sgl_matrix_projection(ctx);
+            _sgl_matrix_t list_proj;
+            if (ctx->in_list) {
+                _sgl_identity(&list_proj);
+                proj = &list_proj;
+            }
+            if (cpu_transform) {
+                uni_data.mvp = *proj;
+                _sgl_identity(&uni_data.tm);
+            }
+            else {
+                _sgl_matmul4(&uni_data.mvp, proj, _sgl_matrix_modelview(ctx));
+                uni_data.tm = *_sgl_matrix_texture(ctx);
+            }
+            if (thick) {
+                _sgl_thick_params(ctx, ctx->cur_prim_type, &uni_data.tm);
+            }
+        }
+        if (!new_uniform && compare_uniform && (ctx->cur_uniform > 0)) {
+            new_uniform = 0 != memcmp(&uni_data, &ctx->uniforms[ctx->cur_uniform - 1], sizeof(uni_data));
+        }
+        if (new_uniform) {
+            ctx->matrix_dirty = false;
+            ctx->thick_uniform = thick;
+            ctx->cpu_uniform = cpu_transform;
+            _sgl_uniform_t* uni = _sgl_next_uniform(ctx);
+            if (uni) {
+                *uni = uni_data;
+            }
+        }
+        /* check if command can be merged with previous command */
+        sg_pipeline pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
+        sg_image img = ctx->texturing_enabled ? ctx->cur_img : _sgl.def_img;
+        _sgl_command_t* prev_cmd = _sgl_prev_command(ctx);
+        bool merge_cmd = false;
+        if (prev_cmd) {
+            if ((prev_cmd->cmd == SGL_COMMAND_DRAW) &&
+                (ctx->cur_prim_type != SGL_PRIMITIVETYPE_LINE_STRIP) &&
+                (ctx->cur_prim_type != SGL_PRIMITIVETYPE_TRIANGLE_STRIP) &&
+                !new_uniform &&
+                (prev_cmd->args.draw.img.id == img.id) &&
+                (prev_cmd->args.draw.pip.id == pip.id))
+            {
+                merge_cmd = true;
+            }
+        }
+        if (merge_cmd) {
+            /* draw command can be merged with the previous command */
+            prev_cmd->args.draw.num_vertices += ctx->cur_vertex - ctx->base_vertex;
+        }
+        else {
+            /* append a new draw command */
+            _sgl_command_t* cmd = _sgl_next_command(ctx);
+            if (cmd) {
+                SOKOL_ASSERT(ctx->cur_uniform > 0);
+                cmd->cmd = SGL_COMMAND_DRAW;
+                cmd->args.draw.img = img;
+                cmd->args.draw.pip = _sgl_get_pipeline(ctx->pip_stack[ctx->pip_tos], ctx->cur_prim_type);
+                cmd->args.draw.base_vertex = ctx->base_vertex;
+                cmd->args.draw.num_vertices = ctx->cur_vertex - ctx->base_vertex;
+                cmd->args.draw.uniform_index = ctx->cur_uniform - 1;
+                cmd->args.draw.indexed = indexed;
+                cmd->args.draw.vertices_per_instance = vertices_per_instance;
+            }
         }
     }
-    if (merge_cmd) {
-        /* draw command can be merged with the previous command */
-        prev_cmd->args.draw.num_vertices += _sgl.cur_vertex - _sgl.base_vertex;
+}
+
+SOKOL_API_IMPL void sgl_line_width(float w) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->line_width = w;
     }
-    else {
-        /* append a new draw command */
-        _sgl_command_t* cmd = _sgl_next_command();
-        if (cmd) {
-            SOKOL_ASSERT(_sgl.cur_uniform > 0);
-            cmd->cmd = SGL_COMMAND_DRAW;
-            cmd->args.draw.img = img;
-            cmd->args.draw.pip = _sgl_get_pipeline(_sgl.pip_stack[_sgl.pip_tos], _sgl.cur_prim_type);
-            cmd->args.draw.base_vertex = _sgl.base_vertex;
-            cmd->args.draw.num_vertices = _sgl.cur_vertex - _sgl.base_vertex;
-            cmd->args.draw.uniform_index = _sgl.cur_uniform - 1;
-        }
+}
+
+SOKOL_API_IMPL void sgl_point_size(float s) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->point_size = s;
+    }
+}
+
+SOKOL_API_IMPL void sgl_aa_width(float w) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->aa_width = w;
     }
 }
 
 SOKOL_API_IMPL void sgl_t2f(float u, float v) {
-    _sgl.u = u; _sgl.v = v;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->u = u; ctx->v = v;
+    }
 }
 
 SOKOL_API_IMPL void sgl_c3f(float r, float g, float b) {
-    _sgl.rgba = _sgl_pack_rgbaf(r, g, b, 1.0f);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbaf(r, g, b, 1.0f);
+    }
 }
 
 SOKOL_API_IMPL void sgl_c4f(float r, float g, float b, float a) {
-    _sgl.rgba = _sgl_pack_rgbaf(r, g, b, a);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbaf(r, g, b, a);
+    }
 }
 
 SOKOL_API_IMPL void sgl_c3b(uint8_t r, uint8_t g, uint8_t b) {
-    _sgl.rgba = _sgl_pack_rgbab(r, g, b, 255);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbab(r, g, b, 255);
+    }
 }
 
 SOKOL_API_IMPL void sgl_c4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl.rgba = _sgl_pack_rgbab(r, g, b, a);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->rgba = _sgl_pack_rgbab(r, g, b, a);
+    }
 }
 
 SOKOL_API_IMPL void sgl_c1i(uint32_t rgba) {
-    _sgl.rgba = rgba;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->rgba = rgba;
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f(float x, float y) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, _sgl.rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, ctx->rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f(float x, float y, float z) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, _sgl.rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, ctx->rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f(float x, float y, float u, float v) {
-    _sgl_vtx(x, y, 0.0f, u, v, _sgl.rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, ctx->rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f(float x, float y, float z, float u, float v) {
-    _sgl_vtx(x, y, z, u, v, _sgl.rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, ctx->rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c3f(float x, float y, float r, float g, float b) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c3b(float x, float y, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, _sgl_pack_rgbab(r, g, b, 255));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c4f(float x, float y, float r, float g, float b, float a) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, _sgl_pack_rgbaf(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c4b(float x, float y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, _sgl_pack_rgbab(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c1i(float x, float y, uint32_t rgba) {
-    _sgl_vtx(x, y, 0.0f, _sgl.u, _sgl.v, rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c3f(float x, float y, float z, float r, float g, float b) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c3b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, _sgl_pack_rgbab(r, g, b, 255));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c4f(float x, float y, float z, float r, float g, float b, float a) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, _sgl_pack_rgbaf(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c4b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, _sgl_pack_rgbab(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c1i(float x, float y, float z, uint32_t rgba) {
-    _sgl_vtx(x, y, z, _sgl.u, _sgl.v, rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c3f(float x, float y, float u, float v, float r, float g, float b) {
-    _sgl_vtx(x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c3b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_vtx(x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c4f(float x, float y, float u, float v, float r, float g, float b, float a) {
-    _sgl_vtx(x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c4b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_vtx(x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c1i(float x, float y, float u, float v, uint32_t rgba) {
-    _sgl_vtx(x, y, 0.0f, u, v, rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, 0.0f, u, v, rgba);
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c3f(float x, float y, float z, float u, float v, float r, float g, float b) {
-    _sgl_vtx(x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_vtx(x, y, z, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, 255));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v, float r, float g, float b, float a) {
-    _sgl_vtx(x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_vtx(x, y, z, u, v, _sgl_pack_rgbab(r, g, b, a));
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, a));
+    }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v, uint32_t rgba) {
-    _sgl_vtx(x, y, z, u, v, rgba);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_vtx(ctx, x, y, z, u, v, rgba);
+    }
+}
+
+SOKOL_API_IMPL void sgl_vertices(const sgl_vertex_t* vertices, int num_vertices) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(ctx->in_begin);
+        SOKOL_ASSERT(vertices && (num_vertices >= 0));
+        _sgl_vertex_t* dst = _sgl_reserve_vertices(ctx, num_vertices);
+        if (dst) {
+            memcpy(dst, vertices, (size_t)num_vertices * sizeof(_sgl_vertex_t));
+        }
+    }
+}
+
+SOKOL_API_IMPL sgl_vertex_t* sgl_reserve(int num_vertices) {
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(ctx->in_begin);
+        SOKOL_ASSERT(num_vertices >= 0);
+        return _sgl_reserve_vertices(ctx, num_vertices);
+    }
+    else {
+        return 0;
+    }
 }
 
 SOKOL_API_IMPL void sgl_matrix_mode_modelview(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
+    }
 }
 
 SOKOL_API_IMPL void sgl_matrix_mode_projection(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.cur_matrix_mode = SGL_MATRIXMODE_PROJECTION;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_PROJECTION;
+    }
 }
 
 SOKOL_API_IMPL void sgl_matrix_mode_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.cur_matrix_mode = SGL_MATRIXMODE_TEXTURE;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        ctx->cur_matrix_mode = SGL_MATRIXMODE_TEXTURE;
+    }
 }
 
 SOKOL_API_IMPL void sgl_load_identity(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_identity(_sgl_matrix());
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_identity(_sgl_matrix(ctx));
+    }
 }
 
 SOKOL_API_IMPL void sgl_load_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    memcpy(&_sgl_matrix()->v[0][0], &m[0], 64);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        memcpy(&_sgl_matrix(ctx)->v[0][0], &m[0], 64);
+    }
 }
 
 SOKOL_API_IMPL void sgl_load_transpose_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_transpose(_sgl_matrix(), (const _sgl_matrix_t*) &m[0]);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_transpose(_sgl_matrix(ctx), (const _sgl_matrix_t*) &m[0]);
+    }
 }
 
 SOKOL_API_IMPL void sgl_mult_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    const _sgl_matrix_t* m0  = (const _sgl_matrix_t*) &m[0];
-    _sgl_mul(_sgl_matrix(), m0);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        const _sgl_matrix_t* m0  = (const _sgl_matrix_t*) &m[0];
+        _sgl_mul(_sgl_matrix(ctx), m0);
+    }
 }
 
 SOKOL_API_IMPL void sgl_mult_transpose_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_matrix_t m0;
-    _sgl_transpose(&m0, (const _sgl_matrix_t*) &m[0]);
-    _sgl_mul(_sgl_matrix(), &m0);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_matrix_t m0;
+        _sgl_transpose(&m0, (const _sgl_matrix_t*) &m[0]);
+        _sgl_mul(_sgl_matrix(ctx), &m0);
+    }
 }
 
 SOKOL_API_IMPL void sgl_rotate(float angle_rad, float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_rotate(_sgl_matrix(), angle_rad, x, y, z);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_rotate(_sgl_matrix(ctx), angle_rad, x, y, z);
+    }
 }
 
 SOKOL_API_IMPL void sgl_scale(float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_scale(_sgl_matrix(), x, y, z);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_scale(_sgl_matrix(ctx), x, y, z);
+    }
 }
 
 SOKOL_API_IMPL void sgl_translate(float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_translate(_sgl_matrix(), x, y, z);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_translate(_sgl_matrix(ctx), x, y, z);
+    }
 }
 
 SOKOL_API_IMPL void sgl_frustum(float l, float r, float b, float t, float n, float f) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_frustum(_sgl_matrix(), l, r, b, t, n, f);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_frustum(_sgl_matrix(ctx), l, r, b, t, n, f);
+    }
 }
 
 SOKOL_API_IMPL void sgl_ortho(float l, float r, float b, float t, float n, float f) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_ortho(_sgl_matrix(), l, r, b, t, n, f);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_ortho(_sgl_matrix(ctx), l, r, b, t, n, f);
+    }
 }
 
 SOKOL_API_IMPL void sgl_perspective(float fov_y, float aspect, float z_near, float z_far) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_perspective(_sgl_matrix(), fov_y, aspect, z_near, z_far);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_perspective(_sgl_matrix(ctx), fov_y, aspect, z_near, z_far);
+    }
 }
 
 SOKOL_API_IMPL void sgl_lookat(float eye_x, float eye_y, float eye_z, float center_x, float center_y, float center_z, float up_x, float up_y, float up_z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl.matrix_dirty = true;
-    _sgl_lookat(_sgl_matrix(), eye_x, eye_y, eye_z, center_x, center_y, center_z, up_x, up_y, up_z);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_matrix_changed(ctx);
+        _sgl_lookat(_sgl_matrix(ctx), eye_x, eye_y, eye_z, center_x, center_y, center_z, up_x, up_y, up_z);
+    }
 }
 
 SOKOL_GL_API_DECL void sgl_push_matrix(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT((_sgl.cur_matrix_mode >= 0) && (_sgl.cur_matrix_mode < SGL_NUM_MATRIXMODES));
-    _sgl.matrix_dirty = true;
-    if (_sgl.matrix_tos[_sgl.cur_matrix_mode] < (_SGL_MAX_STACK_DEPTH - 1)) {
-        const _sgl_matrix_t* src = _sgl_matrix();
-        _sgl.matrix_tos[_sgl.cur_matrix_mode]++;
-        _sgl_matrix_t* dst = _sgl_matrix();
-        *dst = *src;
-    }
-    else {
-        _sgl.error = SGL_ERROR_STACK_OVERFLOW;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
+        _sgl_matrix_changed(ctx);
+        if (ctx->matrix_tos[ctx->cur_matrix_mode] < (_SGL_MAX_STACK_DEPTH - 1)) {
+            const _sgl_matrix_t* src = _sgl_matrix(ctx);
+            ctx->matrix_tos[ctx->cur_matrix_mode]++;
+            _sgl_matrix_t* dst = _sgl_matrix(ctx);
+            *dst = *src;
+        }
+        else {
+            ctx->error = SGL_ERROR_STACK_OVERFLOW;
+        }
     }
 }
 
 SOKOL_GL_API_DECL void sgl_pop_matrix(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    SOKOL_ASSERT((_sgl.cur_matrix_mode >= 0) && (_sgl.cur_matrix_mode < SGL_NUM_MATRIXMODES));
-    _sgl.matrix_dirty = true;
-    if (_sgl.matrix_tos[_sgl.cur_matrix_mode] > 0) {
-        _sgl.matrix_tos[_sgl.cur_matrix_mode]--;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT((ctx->cur_matrix_mode >= 0) && (ctx->cur_matrix_mode < SGL_NUM_MATRIXMODES));
+        _sgl_matrix_changed(ctx);
+        if (ctx->matrix_tos[ctx->cur_matrix_mode] > 0) {
+            ctx->matrix_tos[ctx->cur_matrix_mode]--;
+        }
+        else {
+            ctx->error = SGL_ERROR_STACK_UNDERFLOW;
+        }
     }
-    else {
-        _sgl.error = SGL_ERROR_STACK_UNDERFLOW;
+}
+
+SOKOL_API_IMPL void sgl_begin_list(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin && !ctx->in_list);
+        _sgl_align_vertex(ctx);
+        ctx->in_list = true;
+        ctx->list_base_vertex = ctx->cur_vertex;
+        ctx->list_base_uniform = ctx->cur_uniform;
+        ctx->list_base_command = ctx->cur_command;
+        ctx->list_base_begin_end = ctx->num_begin_end;
+        ctx->matrix_dirty = true;
     }
 }
 
-/* this renders the accumulated draw commands via sokol-gfx */
-SOKOL_API_IMPL void sgl_draw(void) {
+SOKOL_API_IMPL sgl_list sgl_end_list(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    if ((_sgl.error == SGL_NO_ERROR) && (_sgl.cur_vertex > 0) && (_sgl.cur_command > 0)) {
-        uint32_t cur_pip_id = SG_INVALID_ID;
-        uint32_t cur_img_id = SG_INVALID_ID;
-        int cur_uniform_index = -1;
-        sg_push_debug_group("sokol-gl");
-        const sg_range range = { _sgl.vertices, (size_t)_sgl.cur_vertex * sizeof(_sgl_vertex_t) };
-        sg_update_buffer(_sgl.vbuf, &range);
-        _sgl.bind.vertex_buffers[0] = _sgl.vbuf;
-        for (int i = 0; i < _sgl.cur_command; i++) {
-            const _sgl_command_t* cmd = &_sgl.commands[i];
-            switch (cmd->cmd) {
-                case SGL_COMMAND_VIEWPORT:
-                    {
-                        const _sgl_viewport_args_t* args = &cmd->args.viewport;
-                        sg_apply_viewport(args->x, args->y, args->w, args->h, args->origin_top_left);
-                    }
-                    break;
-                case SGL_COMMAND_SCISSOR_RECT:
-                    {
-                        const _sgl_scissor_rect_args_t* args = &cmd->args.scissor_rect;
-                        sg_apply_scissor_rect(args->x, args->y, args->w, args->h, args->origin_top_left);
-                    }
-                    break;
-                case SGL_COMMAND_DRAW:
-                    {
-                        const _sgl_draw_args_t* args = &cmd->args.draw;
-                        if (args->pip.id != cur_pip_id) {
-                            sg_apply_pipeline(args->pip);
-                            cur_pip_id = args->pip.id;
-                            /* when pipeline changes, also need to re-apply uniforms and bindings */
-                            cur_img_id = SG_INVALID_ID;
-                            cur_uniform_index = -1;
-                        }
-                        if (cur_img_id != args->img.id) {
-                            _sgl.bind.fs_images[0] = args->img;
-                            sg_apply_bindings(&_sgl.bind);
-                            cur_img_id = args->img.id;
-                        }
-                        if (cur_uniform_index != args->uniform_index) {
-                            const sg_range ub_range = { &_sgl.uniforms[args->uniform_index], sizeof(_sgl_uniform_t) };
-                            sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &ub_range);
-                            cur_uniform_index = args->uniform_index;
-                        }
-                        /* FIXME: what if number of vertices doesn't match the primitive type? */
-                        if (args->num_vertices > 0) {
-                            sg_draw(args->base_vertex, args->num_vertices, 1);
-                        }
-                    }
-                    break;
+    sgl_list res = _sgl_make_list_id(SG_INVALID_ID);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin && ctx->in_list);
+        if (ctx->error == SGL_NO_ERROR) {
+            res = _sgl_make_list(ctx);
+        }
+        /* remove the recorded list content from the context */
+        ctx->cur_vertex = ctx->list_base_vertex;
+        ctx->cur_uniform = ctx->list_base_uniform;
+        ctx->cur_command = ctx->list_base_command;
+        ctx->num_begin_end = ctx->list_base_begin_end;
+        ctx->list_base_vertex = 0;
+        ctx->list_base_uniform = 0;
+        ctx->list_base_command = 0;
+        ctx->list_base_begin_end = 0;
+        ctx->in_list = false;
+        ctx->matrix_dirty = true;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL void sgl_call_list(sgl_list list_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        SOKOL_ASSERT(!ctx->in_begin);
+        if (ctx->in_list) {
+            SOKOL_LOG("sokol_gl.h: sgl_call_list() can't be called while recording a display list");
+            return;
+        }
+        const _sgl_list_t* list = _sgl_lookup_list(list_id.id);
+        if (0 == list) {
+            return;
+        }
+        #if defined(SOKOL_DEBUG)
+        if (list->ctx.id != ctx->slot.id) {
+            SOKOL_LOG("sokol_gl.h: display list was recorded in a different context");
+            return;
+        }
+        #endif
+        /* premultiply the list's matrices with the current matrices */
+        _sgl_matrix_t mvp;
+        _sgl_matmul4(&mvp, _sgl_matrix_projection(ctx), _sgl_matrix_modelview(ctx));
+        const _sgl_matrix_t* tm = _sgl_matrix_texture(ctx);
+        const int uniform_index = ctx->cur_uniform;
+        for (int i = 0; i < list->num_uniforms; i++) {
+            _sgl_uniform_t* uni = _sgl_next_uniform(ctx);
+            if (0 == uni) {
+                return;
+            }
+            _sgl_matmul4(&uni->mvp, &mvp, &list->uniforms[i].mvp);
+            if (list->thick_uniforms && list->thick_uniforms[i]) {
+                /* thick line parameters are kept, but pixel sizes relate to the current viewport
+                   (or to the viewport at recording time if sgl_viewport() wasn't called yet)
+                */
+                uni->tm = list->uniforms[i].tm;
+                if ((ctx->viewport_w > 0.0f) && (ctx->viewport_h > 0.0f)) {
+                    uni->tm.v[0][0] = ctx->viewport_w;
+                    uni->tm.v[0][1] = ctx->viewport_h;
+                }
+            }
+            else {
+                _sgl_matmul4(&uni->tm, tm, &list->uniforms[i].tm);
             }
         }
-        sg_pop_debug_group();
+        _sgl_command_t* cmd = _sgl_next_command(ctx);
+        if (cmd) {
+            cmd->cmd = SGL_COMMAND_CALL_LIST;
+            cmd->args.call_list.list = list_id;
+            cmd->args.call_list.uniform_index = uniform_index;
+        }
+        /* the next draw command needs its own uniform block */
+        ctx->matrix_dirty = true;
+    }
+}
+
+SOKOL_API_IMPL void sgl_destroy_list(sgl_list list_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_destroy_list(list_id);
+}
+
+SOKOL_API_IMPL void sgl_draw(void) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_cur_ctx();
+    if (ctx) {
+        _sgl_draw(ctx);
+    }
+}
+
+SOKOL_API_IMPL void sgl_context_draw(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* ctx = _sgl_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sgl_draw(ctx);
     }
-    _sgl_rewind();
 }
 #endif /* SOKOL_GL_IMPL */
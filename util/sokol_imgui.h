@@ -138,6 +138,24 @@
                 font. In this case you need to initialize the font
                 yourself after simgui_setup() is called.
 
+            bool use_append_buffer
+                By default, simgui_render() copies the vertices and indices
+                of all ImGui command lists into an intermediate memory buffer,
+                and uploads this with a single sg_update_buffer() call. If
+                use_append_buffer is true, the vertices and indices of each
+                command list are uploaded directly with sg_append_buffer()
+                instead, this avoids the extra copy (which can be significant
+                for complex UIs), but sg_append_buffer() may be slower than
+                a single sg_update_buffer() on some GL platforms.
+
+            bool grow_buffers
+                By default, command lists which don't fit into the vertex-
+                and index-buffers (see max_vertices) are not rendered. If
+                grow_buffers is true, the buffers are instead re-created with
+                (at least) twice the size in simgui_render(), in this case
+                max_vertices only defines the initial buffer size. Buffers
+                never shrink.
+
     --- At the start of a frame, call:
 
         simgui_new_frame(int width, int height, double delta_time)
@@ -236,6 +254,8 @@ typedef struct simgui_desc_t {
     const char* ini_filename;
     bool no_default_font;
     bool disable_hotkeys;   /* don't let ImGui handle Ctrl-A,C,V,X,Y,Z */
+    bool use_append_buffer; /* upload each command list with sg_append_buffer() instead of copying */
+    bool grow_buffers;      /* grow the vertex- and index-buffer instead of dropping command lists */
 } simgui_desc_t;
 
 SOKOL_IMGUI_API_DECL void simgui_setup(const simgui_desc_t* desc);
@@ -319,8 +339,8 @@ typedef struct {
     sg_pipeline pip;
     bool is_osx;    // return true if running on OSX (or HTML5 OSX), needed for copy/paste
 
-    sg_range vertices;
-    sg_range indices;
+    sg_range vertices;      /* intermediate memory buffers, ptr is null with use_append_buffer */
+    sg_range indices;       /* (size is always the size of the sokol-gfx buffers) */
 
     #if !defined(SOKOL_IMGUI_NO_SOKOL_APP)
     bool btn_down[SAPP_MAX_MOUSEBUTTONS];
@@ -1016,6 +1036,77 @@ static bool _simgui_is_osx(void) {
     #endif
 }
 
+/* create the vertex- and index-buffer, and without use_append_buffer the intermediate memory buffers */
+static void _simgui_make_buffers(size_t vtx_size, size_t idx_size) {
+    SOKOL_ASSERT((vtx_size > 0) && (idx_size > 0));
+    SOKOL_ASSERT((_simgui.vbuf.id == SG_INVALID_ID) && (_simgui.ibuf.id == SG_INVALID_ID));
+    SOKOL_ASSERT((0 == _simgui.vertices.ptr) && (0 == _simgui.indices.ptr));
+    _simgui.vertices.size = vtx_size;
+    _simgui.indices.size = idx_size;
+    if (!_simgui.desc.use_append_buffer) {
+        _simgui.vertices.ptr = SOKOL_MALLOC(_simgui.vertices.size);
+        SOKOL_ASSERT(_simgui.vertices.ptr);
+        _simgui.indices.ptr = SOKOL_MALLOC(_simgui.indices.size);
+        SOKOL_ASSERT(_simgui.indices.ptr);
+    }
+
+    /* NOTE: since we're in C++ mode here we can't use C99 designated init */
+    sg_buffer_desc vb_desc;
+    memset(&vb_desc, 0, sizeof(vb_desc));
+    vb_desc.usage = SG_USAGE_STREAM;
+    vb_desc.size = _simgui.vertices.size;
+    vb_desc.label = "sokol-imgui-vertices";
+    _simgui.vbuf = sg_make_buffer(&vb_desc);
+
+    sg_buffer_desc ib_desc;
+    memset(&ib_desc, 0, sizeof(ib_desc));
+    ib_desc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    ib_desc.usage = SG_USAGE_STREAM;
+    ib_desc.size = _simgui.indices.size;
+    ib_desc.label = "sokol-imgui-indices";
+    _simgui.ibuf = sg_make_buffer(&ib_desc);
+}
+
+static void _simgui_destroy_buffers(void) {
+    /* NOTE: it's valid to call the destroy funcs with SG_INVALID_ID */
+    sg_destroy_buffer(_simgui.ibuf);
+    sg_destroy_buffer(_simgui.vbuf);
+    _simgui.ibuf.id = SG_INVALID_ID;
+    _simgui.vbuf.id = SG_INVALID_ID;
+    if (_simgui.vertices.ptr) {
+        SOKOL_FREE((void*)_simgui.vertices.ptr);
+        _simgui.vertices.ptr = 0;
+    }
+    if (_simgui.indices.ptr) {
+        SOKOL_FREE((void*)_simgui.indices.ptr);
+        _simgui.indices.ptr = 0;
+    }
+}
+
+/* re-create the buffers with (at least) twice the size if they can't hold the requested data */
+static void _simgui_grow_buffers(size_t vtx_size, size_t idx_size) {
+    size_t new_vtx_size = _simgui.vertices.size;
+    size_t new_idx_size = _simgui.indices.size;
+    if (vtx_size > new_vtx_size) {
+        new_vtx_size = (vtx_size > (2 * new_vtx_size)) ? vtx_size : (2 * new_vtx_size);
+    }
+    if (idx_size > new_idx_size) {
+        new_idx_size = (idx_size > (2 * new_idx_size)) ? idx_size : (2 * new_idx_size);
+    }
+    _simgui_destroy_buffers();
+    _simgui_make_buffers(new_vtx_size, new_idx_size);
+}
+
+/* size of a vertex- or index-chunk in the sokol-gfx buffers (sg_append_buffer() rounds up to 4 bytes) */
+static size_t _simgui_chunk_size(size_t size) {
+    if (_simgui.desc.use_append_buffer) {
+        return (size + 3) & ~(size_t)3;
+    }
+    else {
+        return size;
+    }
+}
+
 SOKOL_API_IMPL void simgui_setup(const simgui_desc_t* desc) {
     SOKOL_ASSERT(desc);
     memset(&_simgui, 0, sizeof(_simgui));
@@ -1029,15 +1120,6 @@ SOKOL_API_IMPL void simgui_setup(const simgui_desc_t* desc) {
        since sokol_gfx.h will do its own default-value handling
     */
 
-    /* allocate an intermediate vertex- and index-buffer */
-    SOKOL_ASSERT(_simgui.desc.max_vertices > 0);
-    _simgui.vertices.size = (size_t)_simgui.desc.max_vertices * sizeof(ImDrawVert);
-    _simgui.vertices.ptr = SOKOL_MALLOC(_simgui.vertices.size);
-    SOKOL_ASSERT(_simgui.vertices.ptr);
-    _simgui.indices.size = (size_t)_simgui.desc.max_vertices * 3 * sizeof(ImDrawIdx);
-    _simgui.indices.ptr = SOKOL_MALLOC(_simgui.indices.size);
-    SOKOL_ASSERT(_simgui.indices.ptr);
-
     /* initialize Dear ImGui */
     #if defined(__cplusplus)
         ImGui::CreateContext();
@@ -1089,21 +1171,10 @@ SOKOL_API_IMPL void simgui_setup(const simgui_desc_t* desc) {
     /* create sokol-gfx resources */
     sg_push_debug_group("sokol-imgui");
 
-    /* NOTE: since we're in C++ mode here we can't use C99 designated init */
-    sg_buffer_desc vb_desc;
-    memset(&vb_desc, 0, sizeof(vb_desc));
-    vb_desc.usage = SG_USAGE_STREAM;
-    vb_desc.size = _simgui.vertices.size;
-    vb_desc.label = "sokol-imgui-vertices";
-    _simgui.vbuf = sg_make_buffer(&vb_desc);
-
-    sg_buffer_desc ib_desc;
-    memset(&ib_desc, 0, sizeof(ib_desc));
-    ib_desc.type = SG_BUFFERTYPE_INDEXBUFFER;
-    ib_desc.usage = SG_USAGE_STREAM;
-    ib_desc.size = _simgui.indices.size;
-    ib_desc.label = "sokol-imgui-indices";
-    _simgui.ibuf = sg_make_buffer(&ib_desc);
+    /* vertex- and index-buffer (and the intermediate memory buffers) */
+    SOKOL_ASSERT(_simgui.desc.max_vertices > 0);
+    _simgui_make_buffers((size_t)_simgui.desc.max_vertices * sizeof(ImDrawVert),
+                         (size_t)_simgui.desc.max_vertices * 3 * sizeof(ImDrawIdx));
 
     /* default font texture */
     if (!_simgui.desc.no_default_font) {
@@ -1182,8 +1253,8 @@ SOKOL_API_IMPL void simgui_setup(const simgui_desc_t* desc) {
         shd_desc.vs.bytecode = SG_RANGE(_simgui_vs_bytecode_wgpu);
         shd_desc.fs.bytecode = SG_RANGE(_simgui_fs_bytecode_wgpu);
     #else
-        shd_desc.vs.source = _simgui_vs_src_dummy;
-        shd_desc.fs.source = _simgui_fs_src_dummy;
+        shd_desc.vs.source = _simgui_vs_source_dummy;
+        shd_desc.fs.source = _simgui_fs_source_dummy;
     #endif
     _simgui.shd = sg_make_shader(&shd_desc);
 
@@ -1232,13 +1303,8 @@ SOKOL_API_IMPL void simgui_shutdown(void) {
     sg_destroy_pipeline(_simgui.pip);
     sg_destroy_shader(_simgui.shd);
     sg_destroy_image(_simgui.img);
-    sg_destroy_buffer(_simgui.ibuf);
-    sg_destroy_buffer(_simgui.vbuf);
+    _simgui_destroy_buffers();
     sg_pop_debug_group();
-    SOKOL_ASSERT(_simgui.vertices.ptr);
-    SOKOL_FREE((void*)_simgui.vertices.ptr);
-    SOKOL_ASSERT(_simgui.indices.ptr);
-    SOKOL_FREE((void*)_simgui.indices.ptr);
 }
 
 #if !defined(SOKOL_IMGUI_NO_SOKOL_APP)
@@ -1312,41 +1378,29 @@ SOKOL_API_IMPL void simgui_render(ImDrawData* draw_data) {
     if (draw_data->CmdListsCount == 0) {
         return;
     }
-    /* copy vertices and indices into an intermediate buffer so that
-       they can be updated with a single sg_update_buffer() call each
-       (sg_append_buffer() has performance problems on some GL platforms),
-       also keep track of valid number of command lists in case of a
-       buffer overflow
+    /* compute the size of all vertex- and index-data, and keep track of
+       the number of command lists which fit into the buffers, or grow
+       the buffers with the grow_buffers option
     */
     size_t all_vtx_size = 0;
     size_t all_idx_size = 0;
     int cmd_list_count = 0;
     for (int cl_index = 0; cl_index < draw_data->CmdListsCount; cl_index++, cmd_list_count++) {
-        ImDrawList* cl = draw_data->CmdLists[cl_index];
+        const ImDrawList* cl = draw_data->CmdLists[cl_index];
         #if defined(__cplusplus)
-            const size_t vtx_size = cl->VtxBuffer.size() * sizeof(ImDrawVert);
-            const size_t idx_size = cl->IdxBuffer.size() * sizeof(ImDrawIdx);
-            const ImDrawVert* vtx_ptr = &cl->VtxBuffer.front();
-            const ImDrawIdx* idx_ptr = &cl->IdxBuffer.front();
+            const size_t vtx_size = _simgui_chunk_size(cl->VtxBuffer.size() * sizeof(ImDrawVert));
+            const size_t idx_size = _simgui_chunk_size(cl->IdxBuffer.size() * sizeof(ImDrawIdx));
         #else
-            const size_t vtx_size = (size_t)cl->VtxBuffer.Size * sizeof(ImDrawVert);
-            const size_t idx_size = (size_t)cl->IdxBuffer.Size * sizeof(ImDrawIdx);
-            const ImDrawVert* vtx_ptr = cl->VtxBuffer.Data;
-            const ImDrawIdx* idx_ptr = cl->IdxBuffer.Data;
+            const size_t vtx_size = _simgui_chunk_size((size_t)cl->VtxBuffer.Size * sizeof(ImDrawVert));
+            const size_t idx_size = _simgui_chunk_size((size_t)cl->IdxBuffer.Size * sizeof(ImDrawIdx));
         #endif
-
         /* check for buffer overflow */
-        if (((all_vtx_size + vtx_size) > _simgui.vertices.size) ||
-            ((all_idx_size + idx_size) > _simgui.indices.size))
+        if (!_simgui.desc.grow_buffers &&
+            (((all_vtx_size + vtx_size) > _simgui.vertices.size) ||
+             ((all_idx_size + idx_size) > _simgui.indices.size)))
         {
             break;
         }
-
-        /* copy vertices and indices into common buffers */
-        void* dst_vtx_ptr = (void*) (((uint8_t*)_simgui.vertices.ptr) + all_vtx_size);
-        void* dst_idx_ptr = (void*) (((uint8_t*)_simgui.indices.ptr) + all_idx_size);
-        memcpy(dst_vtx_ptr, vtx_ptr, vtx_size);
-        memcpy(dst_idx_ptr, idx_ptr, idx_size);
         all_vtx_size += vtx_size;
         all_idx_size += idx_size;
     }
@@ -1354,14 +1408,75 @@ SOKOL_API_IMPL void simgui_render(ImDrawData* draw_data) {
         return;
     }
 
-    /* update the sokol-gfx vertex- and index-buffer */
     sg_push_debug_group("sokol-imgui");
-    sg_range vtx_data = _simgui.vertices;
-    vtx_data.size = all_vtx_size;
-    sg_range idx_data = _simgui.indices;
-    idx_data.size = all_idx_size;
-    sg_update_buffer(_simgui.vbuf, &vtx_data);
-    sg_update_buffer(_simgui.ibuf, &idx_data);
+    if ((all_vtx_size > _simgui.vertices.size) || (all_idx_size > _simgui.indices.size)) {
+        SOKOL_ASSERT(_simgui.desc.grow_buffers);
+        _simgui_grow_buffers(all_vtx_size, all_idx_size);
+    }
+
+    /* update the sokol-gfx vertex- and index-buffer, either with
+       a single sg_update_buffer() call each from an intermediate
+       buffer (sg_append_buffer() has performance problems on some
+       GL platforms), or by appending each command list directly
+    */
+    int vb_offset = 0;
+    int ib_offset = 0;
+    bool first_vtx_append = true;
+    bool first_idx_append = true;
+    size_t copy_vtx_size = 0;
+    size_t copy_idx_size = 0;
+    for (int cl_index = 0; cl_index < cmd_list_count; cl_index++) {
+        const ImDrawList* cl = draw_data->CmdLists[cl_index];
+        #if defined(__cplusplus)
+            const size_t vtx_size = cl->VtxBuffer.size() * sizeof(ImDrawVert);
+            const size_t idx_size = cl->IdxBuffer.size() * sizeof(ImDrawIdx);
+            const ImDrawVert* vtx_ptr = &cl->VtxBuffer.front();
+            const ImDrawIdx* idx_ptr = &cl->IdxBuffer.front();
+        #else
+            const size_t vtx_size = (size_t)cl->VtxBuffer.Size * sizeof(ImDrawVert);
+            const size_t idx_size = (size_t)cl->IdxBuffer.Size * sizeof(ImDrawIdx);
+            const ImDrawVert* vtx_ptr = cl->VtxBuffer.Data;
+            const ImDrawIdx* idx_ptr = cl->IdxBuffer.Data;
+        #endif
+        if (_simgui.desc.use_append_buffer) {
+            /* command lists are appended back to back, the start offsets
+               are only non-zero if simgui_render() was called before in this frame
+            */
+            if (vtx_size > 0) {
+                sg_range vtx_data = { vtx_ptr, vtx_size };
+                const int vtx_pos = sg_append_buffer(_simgui.vbuf, &vtx_data);
+                if (first_vtx_append) {
+                    first_vtx_append = false;
+                    vb_offset = vtx_pos;
+                }
+            }
+            if (idx_size > 0) {
+                sg_range idx_data = { idx_ptr, idx_size };
+                const int idx_pos = sg_append_buffer(_simgui.ibuf, &idx_data);
+                if (first_idx_append) {
+                    first_idx_append = false;
+                    ib_offset = idx_pos;
+                }
+            }
+        }
+        else {
+            /* copy vertices and indices into common buffers */
+            void* dst_vtx_ptr = (void*) (((uint8_t*)_simgui.vertices.ptr) + copy_vtx_size);
+            void* dst_idx_ptr = (void*) (((uint8_t*)_simgui.indices.ptr) + copy_idx_size);
+            memcpy(dst_vtx_ptr, vtx_ptr, vtx_size);
+            memcpy(dst_idx_ptr, idx_ptr, idx_size);
+            copy_vtx_size += vtx_size;
+            copy_idx_size += idx_size;
+        }
+    }
+    if (!_simgui.desc.use_append_buffer) {
+        sg_range vtx_data = _simgui.vertices;
+        vtx_data.size = copy_vtx_size;
+        sg_range idx_data = _simgui.indices;
+        idx_data.size = copy_idx_size;
+        sg_update_buffer(_simgui.vbuf, &vtx_data);
+        sg_update_buffer(_simgui.ibuf, &idx_data);
+    }
 
     /* render the ImGui command list */
     const float dpi_scale = _simgui.desc.dpi_scale;
@@ -1382,17 +1497,27 @@ SOKOL_API_IMPL void simgui_render(ImDrawData* draw_data) {
     memset((void*)&bind, 0, sizeof(bind));
     bind.vertex_buffers[0] = _simgui.vbuf;
     bind.index_buffer = _simgui.ibuf;
-    ImTextureID tex_id = io->Fonts->TexID;
-    bind.fs_images[0].id = (uint32_t)(uintptr_t)tex_id;
-    int vb_offset = 0;
-    int ib_offset = 0;
+    bind.fs_images[0].id = (uint32_t)(uintptr_t)io->Fonts->TexID;
+
+    /* keep track of applied state to skip redundant sokol-gfx calls:
+        - bind_dirty: bindings need to be applied before the next draw
+        - state_dirty: a user callback was called, all state must be
+          re-applied before the next draw
+        - scissor: the last applied scissor rect, starts out invalid
+          because the current scissor rect of the pass is unknown
+    */
+    bool bind_dirty = true;
+    bool state_dirty = false;
+    int scissor[4] = { 0, 0, -1, -1 };
     ImVec2 clip_offset = draw_data->DisplayPos;
     for (int cl_index = 0; cl_index < cmd_list_count; cl_index++) {
         const ImDrawList* cl = draw_data->CmdLists[cl_index];
 
-        bind.vertex_buffer_offsets[0] = vb_offset;
-        bind.index_buffer_offset = ib_offset;
-        sg_apply_bindings(&bind);
+        /* the vertex buffer offset is checked per draw command */
+        if (bind.index_buffer_offset != ib_offset) {
+            bind.index_buffer_offset = ib_offset;
+            bind_dirty = true;
+        }
 
         int base_element = 0;
         #if defined(__cplusplus)
@@ -1400,40 +1525,87 @@ SOKOL_API_IMPL void simgui_render(ImDrawData* draw_data) {
         #else
             const int num_cmds = cl->CmdBuffer.Size;
         #endif
-        uint32_t vtx_offset = 0;
-        for (int cmd_index = 0; cmd_index < num_cmds; cmd_index++) {
-            ImDrawCmd* pcmd = &cl->CmdBuffer.Data[cmd_index];
+        int cmd_index = 0;
+        while (cmd_index < num_cmds) {
+            const ImDrawCmd* pcmd = &cl->CmdBuffer.Data[cmd_index];
             if (pcmd->UserCallback) {
-                pcmd->UserCallback(cl, pcmd);
+                #if defined(ImDrawCallback_ResetRenderState)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                #endif
+                {
+                    pcmd->UserCallback(cl, pcmd);
+                }
                 // need to re-apply all state after calling a user callback
-                sg_apply_viewport(0, 0, fb_width, fb_height, true);
-                sg_apply_pipeline(_simgui.pip);
-                sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, SG_RANGE_REF(vs_params));
-                sg_apply_bindings(&bind);
+                state_dirty = true;
+                base_element += (int)pcmd->ElemCount;
+                cmd_index++;
+                continue;
             }
-            else {
-                if ((tex_id != pcmd->TextureId) || (vtx_offset != pcmd->VtxOffset)) {
-                    tex_id = pcmd->TextureId;
-                    vtx_offset = pcmd->VtxOffset;
-                    bind.fs_images[0].id = (uint32_t)(uintptr_t)tex_id;
-                    bind.vertex_buffer_offsets[0] = vb_offset + (int)(pcmd->VtxOffset * sizeof(ImDrawVert));
+
+            /* merge the following draw commands with identical texture,
+               vertex offset and clip rect into a single draw call
+            */
+            int num_elements = (int)pcmd->ElemCount;
+            int next_index = cmd_index + 1;
+            while (next_index < num_cmds) {
+                const ImDrawCmd* next_cmd = &cl->CmdBuffer.Data[next_index];
+                if ((next_cmd->UserCallback != 0) ||
+                    (next_cmd->TextureId != pcmd->TextureId) ||
+                    (next_cmd->VtxOffset != pcmd->VtxOffset) ||
+                    (next_cmd->ClipRect.x != pcmd->ClipRect.x) ||
+                    (next_cmd->ClipRect.y != pcmd->ClipRect.y) ||
+                    (next_cmd->ClipRect.z != pcmd->ClipRect.z) ||
+                    (next_cmd->ClipRect.w != pcmd->ClipRect.w))
+                {
+                    break;
+                }
+                num_elements += (int)next_cmd->ElemCount;
+                next_index++;
+            }
+
+            if (num_elements > 0) {
+                if (state_dirty) {
+                    state_dirty = false;
+                    bind_dirty = true;
+                    sg_apply_viewport(0, 0, fb_width, fb_height, true);
+                    sg_apply_pipeline(_simgui.pip);
+                    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, SG_RANGE_REF(vs_params));
+                    /* force re-applying the scissor rect */
+                    scissor[2] = -1;
+                }
+                const uint32_t img_id = (uint32_t)(uintptr_t)pcmd->TextureId;
+                const int vtx_offset = vb_offset + (int)(pcmd->VtxOffset * sizeof(ImDrawVert));
+                if ((bind.fs_images[0].id != img_id) || (bind.vertex_buffer_offsets[0] != vtx_offset)) {
+                    bind.fs_images[0].id = img_id;
+                    bind.vertex_buffer_offsets[0] = vtx_offset;
+                    bind_dirty = true;
+                }
+                if (bind_dirty) {
+                    bind_dirty = false;
                     sg_apply_bindings(&bind);
                 }
                 const int scissor_x = (int) ((pcmd->ClipRect.x - clip_offset.x   ) * dpi_scale);
                 const int scissor_y = (int) ((pcmd->ClipRect.y - clip_offset.y   ) * dpi_scale);
                 const int scissor_w = (int) ((pcmd->ClipRect.z - pcmd->ClipRect.x) * dpi_scale);
                 const int scissor_h = (int) ((pcmd->ClipRect.w - pcmd->ClipRect.y) * dpi_scale);
-                sg_apply_scissor_rect(scissor_x, scissor_y, scissor_w, scissor_h, true);
-                sg_draw(base_element, (int)pcmd->ElemCount, 1);
+                if ((scissor[0] != scissor_x) || (scissor[1] != scissor_y) || (scissor[2] != scissor_w) || (scissor[3] != scissor_h)) {
+                    scissor[0] = scissor_x;
+                    scissor[1] = scissor_y;
+                    scissor[2] = scissor_w;
+                    scissor[3] = scissor_h;
+                    sg_apply_scissor_rect(scissor_x, scissor_y, scissor_w, scissor_h, true);
+                }
+                sg_draw(base_element, num_elements, 1);
             }
-            base_element += (int)pcmd->ElemCount;
+            base_element += num_elements;
+            cmd_index = next_index;
         }
         #if defined(__cplusplus)
-            const size_t vtx_size = cl->VtxBuffer.size() * sizeof(ImDrawVert);
-            const size_t idx_size = cl->IdxBuffer.size() * sizeof(ImDrawIdx);
+            const size_t vtx_size = _simgui_chunk_size(cl->VtxBuffer.size() * sizeof(ImDrawVert));
+            const size_t idx_size = _simgui_chunk_size(cl->IdxBuffer.size() * sizeof(ImDrawIdx));
         #else
-            const size_t vtx_size = (size_t)cl->VtxBuffer.Size * sizeof(ImDrawVert);
-            const size_t idx_size = (size_t)cl->IdxBuffer.Size * sizeof(ImDrawIdx);
+            const size_t vtx_size = _simgui_chunk_size((size_t)cl->VtxBuffer.Size * sizeof(ImDrawVert));
+            const size_t idx_size = _simgui_chunk_size((size_t)cl->IdxBuffer.Size * sizeof(ImDrawIdx));
         #endif
         vb_offset += (int)vtx_size;
         ib_offset += (int)idx_size;
@@ -117,6 +117,16 @@
                 font. In this case you need to initialize the font
                 yourself after snk_setup() is called.
 
+            bool skip_unchanged
+                Set this to true to skip converting and uploading the UI
+                geometry in frames where the UI didn't change. snk_render()
+                then computes a hash over Nuklear's command buffer, and
+                if it's identical to the previous frame, the UI is rendered
+                from the previous frame's vertex- and index-buffer content
+                without calling nk_convert() and sg_update_buffer().
+                For mostly static UIs this removes most of the UI's CPU
+                cost. The default is false.
+
     --- At the start of a frame, call:
 
         struct nk_context *snk_new_frame()
@@ -217,6 +227,7 @@ typedef struct snk_desc_t {
     int sample_count;
     float dpi_scale;
     bool no_default_font;
+    bool skip_unchanged;    /* skip nk_convert() and buffer updates if the UI didn't change */
 } snk_desc_t;
 
 SOKOL_NUKLEAR_API_DECL void snk_setup(const snk_desc_t* desc);
@@ -291,6 +302,13 @@ typedef struct _snk_vertex_t {
     uint8_t col[4];
 } _snk_vertex_t;
 
+/* a recorded draw command, kept around for skip_unchanged */
+typedef struct _snk_draw_cmd_t {
+    struct nk_rect clip_rect;
+    int base_element;
+    int num_elements;
+} _snk_draw_cmd_t;
+
 typedef struct _snk_vs_params_t {
     float   disp_size[2];
     uint8_t _pad_8[8];
@@ -309,6 +327,9 @@ typedef struct {
     sg_shader shd;
     sg_pipeline pip;
     bool is_osx;    /* return true if running on OSX (or HTML5 OSX), needed for copy/paste */
+    struct nk_buffer draw_cmds;     /* _snk_draw_cmd_t items of the last converted frame */
+    bool draw_cmds_valid;           /* false if the buffers don't contain a renderable frame */
+    uint64_t cmd_hash;              /* hash of the command buffer in the last converted frame */
     #if !defined(SOKOL_NUKLEAR_NO_SOKOL_APP)
     int mouse_pos[2];
     float mouse_scroll[2];
@@ -1675,6 +1696,7 @@ SOKOL_API_IMPL void snk_setup(const snk_desc_t* desc) {
     _snuklear.ctx.clip.copy = _snk_clipboard_copy;
     _snuklear.ctx.clip.paste = _snk_clipboard_paste;
 #endif
+    nk_buffer_init_default(&_snuklear.draw_cmds);
 
     /* create sokol-gfx resources */
     sg_push_debug_group("sokol-nuklear");
@@ -1764,8 +1786,8 @@ SOKOL_API_IMPL void snk_setup(const snk_desc_t* desc) {
         vs_bytecode = SG_RANGE(_snk_vs_bytecode_wgpu);
         fs_bytecode = SG_RANGE(_snk_fs_bytecode_wgpu);
     #else
-        shd_desc.vs.source = _snk_vs_source_dummy;
-        shd_desc.fs.source = _snk_fs_source_dummy;
+        vs_source = _snk_vs_source_dummy;
+        fs_source = _snk_fs_source_dummy;
     #endif
 
     /* Shader */
@@ -1828,6 +1850,7 @@ SOKOL_API_IMPL void snk_setup(const snk_desc_t* desc) {
 }
 
 SOKOL_API_IMPL void snk_shutdown(void) {
+    nk_buffer_free(&_snuklear.draw_cmds);
     nk_free(&_snuklear.ctx);
     nk_font_atlas_clear(&_snuklear.atlas);
 
@@ -1886,7 +1909,19 @@ SOKOL_API_IMPL struct nk_context* snk_new_frame(void) {
     return &_snuklear.ctx;
 }
 
-SOKOL_API_IMPL void snk_render(int width, int height) {
+/* FNV-1a hash over Nuklear's command buffer */
+_SOKOL_PRIVATE uint64_t _snk_hash(const void* ptr, size_t size) {
+    const uint8_t* bytes = (const uint8_t*) ptr;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/* convert the Nuklear command list into the vertex- and index-buffer, and record the draw commands */
+_SOKOL_PRIVATE void _snk_convert(void) {
     static const struct nk_draw_vertex_layout_element vertex_layout[] = {
         {NK_VERTEX_POSITION, NK_FORMAT_FLOAT, NK_OFFSETOF(struct _snk_vertex_t, pos)},
         {NK_VERTEX_TEXCOORD, NK_FORMAT_FLOAT, NK_OFFSETOF(struct _snk_vertex_t, uv)},
@@ -1905,15 +1940,14 @@ SOKOL_API_IMPL void snk_render(int width, int height) {
         .global_alpha = 1.0f
     };
 
-    _snuklear.vs_params.disp_size[0] = (float)width;
-    _snuklear.vs_params.disp_size[1] = (float)height;
-
     /* Setup vert/index buffers and convert */
     struct nk_buffer cmds, verts, idx;
     nk_buffer_init_default(&cmds);
     nk_buffer_init_default(&verts);
     nk_buffer_init_default(&idx);
     nk_convert(&_snuklear.ctx, &cmds, &verts, &idx, &cfg);
+    nk_buffer_clear(&_snuklear.draw_cmds);
+    _snuklear.draw_cmds_valid = false;
 
     /* Check for vertex- and index-buffer overflow, assert in debug-mode,
        otherwise silently skip rendering
@@ -1922,40 +1956,24 @@ SOKOL_API_IMPL void snk_render(int width, int height) {
     const bool index_buffer_overflow = nk_buffer_total(&idx) > _snuklear.index_buffer_size;
     SOKOL_ASSERT(!vertex_buffer_overflow && !index_buffer_overflow);
     if (!vertex_buffer_overflow && !index_buffer_overflow) {
-
-        /* Setup rendering */
-        const float dpi_scale = _snuklear.desc.dpi_scale;
-        const int fb_width = (int)(_snuklear.vs_params.disp_size[0] * dpi_scale);
-        const int fb_height = (int)(_snuklear.vs_params.disp_size[1] * dpi_scale);
-        sg_apply_viewport(0, 0, fb_width, fb_height, true);
-        sg_apply_scissor_rect(0, 0, fb_width, fb_height, true);
-        sg_apply_pipeline(_snuklear.pip);
-        sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(_snuklear.vs_params));
         sg_update_buffer(_snuklear.vbuf, &(sg_range){ nk_buffer_memory_const(&verts), nk_buffer_total(&verts) });
         sg_update_buffer(_snuklear.ibuf, &(sg_range){ nk_buffer_memory_const(&idx), nk_buffer_total(&idx) });
 
-        /* Iterate through the command list, rendering each one */
+        /* record the draw commands, so they can be re-used with skip_unchanged */
         const struct nk_draw_command* cmd = NULL;
-        int idx_offset = 0;
+        int base_element = 0;
         nk_draw_foreach(cmd, &_snuklear.ctx, &cmds) {
             if (cmd->elem_count > 0) {
-                sg_apply_bindings(&(sg_bindings){
-                    .fs_images[0] = _snuklear.img,
-                    .vertex_buffers[0] = _snuklear.vbuf,
-                    .index_buffer = _snuklear.ibuf,
-                    .vertex_buffer_offsets[0] = 0,
-                    .index_buffer_offset = idx_offset
-                });
-                sg_apply_scissor_rectf(cmd->clip_rect.x * dpi_scale,
-                                       cmd->clip_rect.y * dpi_scale,
-                                       cmd->clip_rect.w * dpi_scale,
-                                       cmd->clip_rect.h * dpi_scale,
-                                       true);
-                sg_draw(0, (int)cmd->elem_count, 1);
-                idx_offset += (int)cmd->elem_count * (int)sizeof(uint16_t);
+                _snk_draw_cmd_t draw_cmd = {
+                    .clip_rect = cmd->clip_rect,
+                    .base_element = base_element,
+                    .num_elements = (int)cmd->elem_count
+                };
+                nk_buffer_push(&_snuklear.draw_cmds, NK_BUFFER_FRONT, &draw_cmd, sizeof(draw_cmd), NK_ALIGNOF(_snk_draw_cmd_t));
+                base_element += (int)cmd->elem_count;
             }
         }
-        sg_apply_scissor_rect(0, 0, fb_width, fb_height, true);
+        _snuklear.draw_cmds_valid = true;
     }
 
     /* Cleanup */
@@ -1964,6 +1982,58 @@ SOKOL_API_IMPL void snk_render(int width, int height) {
     nk_buffer_free(&idx);
 }
 
+SOKOL_API_IMPL void snk_render(int width, int height) {
+    _snuklear.vs_params.disp_size[0] = (float)width;
+    _snuklear.vs_params.disp_size[1] = (float)height;
+
+    /* with skip_unchanged, only convert and upload the UI if Nuklear's
+       command buffer differs from the last converted frame (nk__begin()
+       links the per-window command buffers in drawing order, so this
+       also catches window order changes)
+    */
+    bool convert = true;
+    if (_snuklear.desc.skip_unchanged) {
+        nk__begin(&_snuklear.ctx);
+        const uint64_t hash = _snk_hash(nk_buffer_memory_const(&_snuklear.ctx.memory), _snuklear.ctx.memory.allocated);
+        convert = !_snuklear.draw_cmds_valid || (hash != _snuklear.cmd_hash);
+        _snuklear.cmd_hash = hash;
+    }
+    if (convert) {
+        _snk_convert();
+    }
+    if (!_snuklear.draw_cmds_valid) {
+        return;
+    }
+
+    /* Setup rendering */
+    const float dpi_scale = _snuklear.desc.dpi_scale;
+    const int fb_width = (int)(_snuklear.vs_params.disp_size[0] * dpi_scale);
+    const int fb_height = (int)(_snuklear.vs_params.disp_size[1] * dpi_scale);
+    sg_apply_viewport(0, 0, fb_width, fb_height, true);
+    sg_apply_scissor_rect(0, 0, fb_width, fb_height, true);
+    sg_apply_pipeline(_snuklear.pip);
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, 0, &SG_RANGE(_snuklear.vs_params));
+    sg_apply_bindings(&(sg_bindings){
+        .fs_images[0] = _snuklear.img,
+        .vertex_buffers[0] = _snuklear.vbuf,
+        .index_buffer = _snuklear.ibuf,
+    });
+
+    /* Iterate through the recorded draw commands, rendering each one */
+    const _snk_draw_cmd_t* draw_cmds = (const _snk_draw_cmd_t*) nk_buffer_memory_const(&_snuklear.draw_cmds);
+    const int num_draw_cmds = (int)(_snuklear.draw_cmds.allocated / sizeof(_snk_draw_cmd_t));
+    for (int i = 0; i < num_draw_cmds; i++) {
+        const _snk_draw_cmd_t* cmd = &draw_cmds[i];
+        sg_apply_scissor_rectf(cmd->clip_rect.x * dpi_scale,
+                               cmd->clip_rect.y * dpi_scale,
+                               cmd->clip_rect.w * dpi_scale,
+                               cmd->clip_rect.h * dpi_scale,
+                               true);
+        sg_draw(cmd->base_element, cmd->num_elements, 1);
+    }
+    sg_apply_scissor_rect(0, 0, fb_width, fb_height, true);
+}
+
 #if !defined(SOKOL_NUKLEAR_NO_SOKOL_APP)
 _SOKOL_PRIVATE bool _snk_is_ctrl(uint32_t modifiers) {
     if (_snuklear.is_osx) {
@@ -20,6 +20,8 @@
     ...optionally provide the following macros to override defaults:
 
     SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_MALLOC(s)     - your own malloc function (default: malloc(s))
+    SOKOL_FREE(p)       - your own free function (default: free(p))
     SOKOL_SHAPE_API_DECL- public function declaration prefix (default: extern)
     SOKOL_API_DECL      - same as SOKOL_SHAPE_API_DECL
     SOKOL_API_IMPL      - public function implementation prefix (default: -)
@@ -55,8 +57,9 @@
             uint32_t color;         // packed color as UBYTE4N (r,g,b,a);
         } sshape_vertex_t;
 
-    Indices are generally 16-bits wide (SG_INDEXTYPE_UINT16) and the indices
-    are written as triangle-lists (SG_PRIMITIVETYPE_TRIANGLES).
+    Indices are 16-bits wide (SG_INDEXTYPE_UINT16) by default, or optionally
+    32-bits wide (SG_INDEXTYPE_UINT32, see "32-BIT INDICES" below), and the
+    indices are written as triangle-lists (SG_PRIMITIVETYPE_TRIANGLES).
 
     EXAMPLES:
     =========
@@ -332,6 +335,72 @@
     sg_draw(green_cube.base_element, green_cube.num_elements, 1);
     ```
 
+    32-BIT INDICES
+    ==============
+    With the default 16-bit indices, all shapes in the same vertex buffer
+    can only address 65536 vertices, and builder functions which would
+    exceed this limit return an invalid buffer. To merge more vertices
+    into the same buffers (for instance thousands of small shapes that
+    should be rendered with a single draw call), set the index32 flag
+    in the sshape_buffer_t struct before building the first shape:
+
+    ```c
+    sshape_vertex_t vertices[200000];
+    uint32_t indices[1000000];
+
+    sshape_buffer_t buf = {
+        .index32 = true,
+        .vertices.buffer = SSHAPE_RANGE(vertices),
+        .indices.buffer = SSHAPE_RANGE(indices),
+    };
+    ```
+
+    The index32 flag must not be changed between builder calls which write
+    into the same buffers. Note that the index buffer sizes returned by
+    the sshape_*_sizes() functions are for 16-bit indices, with 32-bit
+    indices the required index buffer size is:
+
+    ```c
+    uint32_t index_buffer_size = sizes.indices.num * sizeof(uint32_t);
+    ```
+
+    When creating the pipeline object, use the index type returned by
+    sshape_index_type():
+
+    ```c
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        ...
+        .index_type = sshape_index_type(&buf),
+        ...
+    });
+    ```
+
+    OPTIMIZING SHAPES FOR THE VERTEX CACHE
+    ======================================
+    The shape builder functions write triangles in a simple row-by-row
+    order, which doesn't make good use of the GPU's post-transform
+    vertex cache for highly tessellated shapes. To reorder the triangles
+    and vertices of the current shape for better vertex-cache and
+    vertex-fetch locality, call:
+
+    ```c
+    buf = sshape_build_sphere(&buf, &(sshape_sphere_t){ .slices = 64, .stacks = 32 });
+    buf = sshape_optimize(&buf);
+    ```
+
+    sshape_optimize() works on the current element range (the same range
+    that's returned by sshape_element_range()), so when building multiple
+    shapes into the same buffers it must be called after each shape (or
+    after each group of merged shapes). The triangles are reordered with
+    Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" algorithm,
+    and the vertices are then reordered by first use in the new index
+    order. The optimization allocates temporary memory through
+    SOKOL_MALLOC() and SOKOL_FREE(), if allocation fails the buffer
+    content remains unchanged.
+
+    Since this is a relatively expensive operation, it's best done once
+    when the geometry is created, not every frame.
+
     ...that's about all :)
 
     LICENSE
@@ -449,6 +518,7 @@ typedef struct sshape_buffer_item_t {
 
 typedef struct sshape_buffer_t {
     bool valid;
+    bool index32;       // if true, write 32-bit indices (default: false, 16-bit indices)
     sshape_buffer_item_t vertices;
     sshape_buffer_item_t indices;
 } sshape_buffer_t;
@@ -518,10 +588,14 @@ SOKOL_SHAPE_API_DECL sshape_sizes_t sshape_sphere_sizes(uint32_t slices, uint32_
 SOKOL_SHAPE_API_DECL sshape_sizes_t sshape_cylinder_sizes(uint32_t slices, uint32_t stacks);
 SOKOL_SHAPE_API_DECL sshape_sizes_t sshape_torus_sizes(uint32_t sides, uint32_t rings);
 
+/* reorder triangles and vertices of the current shape for better vertex cache usage */
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_optimize(const sshape_buffer_t* buf);
+
 /* extract sokol-gfx desc structs and primitive ranges from build state */
 SOKOL_SHAPE_API_DECL sshape_element_range_t sshape_element_range(const sshape_buffer_t* buf);
 SOKOL_SHAPE_API_DECL sg_buffer_desc sshape_vertex_buffer_desc(const sshape_buffer_t* buf);
 SOKOL_SHAPE_API_DECL sg_buffer_desc sshape_index_buffer_desc(const sshape_buffer_t* buf);
+SOKOL_SHAPE_API_DECL sg_index_type sshape_index_type(const sshape_buffer_t* buf);
 SOKOL_SHAPE_API_DECL sg_buffer_layout_desc sshape_buffer_layout_desc(void);
 SOKOL_SHAPE_API_DECL sg_vertex_attr_desc sshape_position_attr_desc(void);
 SOKOL_SHAPE_API_DECL sg_vertex_attr_desc sshape_normal_attr_desc(void);
@@ -566,6 +640,11 @@ SOKOL_SHAPE_API_DECL sshape_mat4_t sshape_mat4_transpose(const float m[16]);
     #include <assert.h>
     #define SOKOL_ASSERT(c) assert(c)
 #endif
+#ifndef SOKOL_MALLOC
+    #include <stdlib.h>
+    #define SOKOL_MALLOC(s) malloc(s)
+    #define SOKOL_FREE(p) free(p)
+#endif
 
 #define _sshape_def(val, def) (((val) == 0) ? (def) : (val))
 #define _sshape_def_flt(val, def) (((val) == 0.0f) ? (def) : (val))
@@ -713,11 +792,19 @@ static bool _sshape_validate_buffer_item(const sshape_buffer_item_t* item, uint3
     return true;
 }
 
+static uint32_t _sshape_index_size(const sshape_buffer_t* buf) {
+    return (uint32_t) (buf->index32 ? sizeof(uint32_t) : sizeof(uint16_t));
+}
+
 static bool _sshape_validate_buffer(const sshape_buffer_t* buf, uint32_t num_vertices, uint32_t num_indices) {
     if (!_sshape_validate_buffer_item(&buf->vertices, num_vertices * sizeof(sshape_vertex_t))) {
         return false;
     }
-    if (!_sshape_validate_buffer_item(&buf->indices, num_indices * sizeof(uint16_t))) {
+    if (!_sshape_validate_buffer_item(&buf->indices, num_indices * _sshape_index_size(buf))) {
+        return false;
+    }
+    // 16-bit indices can only address the first 64k vertices
+    if (!buf->index32 && (((buf->vertices.data_size / sizeof(sshape_vertex_t)) + num_vertices) > 0x10000)) {
         return false;
     }
     return true;
@@ -727,8 +814,8 @@ static void _sshape_advance_offset(sshape_buffer_item_t* item) {
     item->shape_offset = item->data_size;
 }
 
-static uint16_t _sshape_base_index(const sshape_buffer_t* buf) {
-    return (uint16_t) (buf->vertices.data_size / sizeof(sshape_vertex_t));
+static uint32_t _sshape_base_index(const sshape_buffer_t* buf) {
+    return (uint32_t) (buf->vertices.data_size / sizeof(sshape_vertex_t));
 }
 
 static sshape_plane_t _sshape_plane_defaults(const sshape_plane_t* params) {
@@ -798,14 +885,61 @@ static void _sshape_add_vertex(sshape_buffer_t* buf, _sshape_vec4_t pos, _sshape
     v_ptr->color = color;
 }
 
-static void _sshape_add_triangle(sshape_buffer_t* buf, uint16_t i0, uint16_t i1, uint16_t i2) {
+static void _sshape_add_triangle(sshape_buffer_t* buf, uint32_t i0, uint32_t i1, uint32_t i2) {
     size_t offset = buf->indices.data_size;
-    SOKOL_ASSERT((offset + 3*sizeof(uint16_t)) <= buf->indices.buffer.size);
-    buf->indices.data_size += 3*sizeof(uint16_t);
-    uint16_t* i_ptr = (uint16_t*) ((uint8_t*)buf->indices.buffer.ptr + offset);
-    i_ptr[0] = i0;
-    i_ptr[1] = i1;
-    i_ptr[2] = i2;
+    const uint32_t index_size = _sshape_index_size(buf);
+    SOKOL_ASSERT((offset + 3*index_size) <= buf->indices.buffer.size);
+    buf->indices.data_size += 3*index_size;
+    if (buf->index32) {
+        uint32_t* i_ptr = (uint32_t*) ((uint8_t*)buf->indices.buffer.ptr + offset);
+        i_ptr[0] = i0;
+        i_ptr[1] = i1;
+        i_ptr[2] = i2;
+    }
+    else {
+        SOKOL_ASSERT((i0 <= 0xFFFF) && (i1 <= 0xFFFF) && (i2 <= 0xFFFF));
+        uint16_t* i_ptr = (uint16_t*) ((uint8_t*)buf->indices.buffer.ptr + offset);
+        i_ptr[0] = (uint16_t) i0;
+        i_ptr[1] = (uint16_t) i1;
+        i_ptr[2] = (uint16_t) i2;
+    }
+}
+
+/* sin/cos of the angles 2pi*i/num for i in 0..num, computed in chunks on the stack
+   (the builder functions don't allocate memory), for up to _SSHAPE_SINCOS_CHUNK_SIZE-1
+   slices or rings the table is only computed once per build
+*/
+#define _SSHAPE_SINCOS_CHUNK_SIZE (256)
+typedef struct { float s, c; } _sshape_sincos_t;
+typedef struct {
+    uint32_t num;
+    uint32_t first;     // index of items[0]
+    uint32_t count;     // number of valid items
+    _sshape_sincos_t items[_SSHAPE_SINCOS_CHUNK_SIZE];
+} _sshape_sincos_table_t;
+
+static void _sshape_sincos_init(_sshape_sincos_table_t* table, uint32_t num) {
+    table->num = num;
+    table->first = 0;
+    table->count = 0;
+}
+
+static inline _sshape_sincos_t _sshape_sincos(_sshape_sincos_table_t* table, uint32_t i) {
+    SOKOL_ASSERT(i <= table->num);
+    if ((i < table->first) || (i >= (table->first + table->count))) {
+        const float two_pi = 2.0f * 3.14159265358979323846f;
+        table->first = i;
+        table->count = table->num + 1 - i;
+        if (table->count > _SSHAPE_SINCOS_CHUNK_SIZE) {
+            table->count = _SSHAPE_SINCOS_CHUNK_SIZE;
+        }
+        for (uint32_t k = 0; k < table->count; k++) {
+            const float angle = (two_pi * (i + k)) / table->num;
+            table->items[k].s = sinf(angle);
+            table->items[k].c = cosf(angle);
+        }
+    }
+    return table->items[i - table->first];
 }
 
 static uint32_t _sshape_rand_color(uint32_t* xorshift_state) {
@@ -822,6 +956,202 @@ static uint32_t _sshape_rand_color(uint32_t* xorshift_state) {
 
 }
 
+/*
+    Vertex cache optimization after Tom Forsyth's "Linear-Speed Vertex Cache
+    Optimisation" (https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html),
+    triangles are emitted greedily by highest score, where the score of a
+    triangle is the sum of its vertex scores, and the vertex score depends
+    on the vertex position in a simulated LRU cache and the number of
+    not yet emitted triangles using the vertex.
+*/
+#define _SSHAPE_VCACHE_SIZE (32)
+#define _SSHAPE_VCACHE_MAX_VALENCE (32)
+
+typedef struct {
+    float cache_score[_SSHAPE_VCACHE_SIZE];
+    float valence_score[_SSHAPE_VCACHE_MAX_VALENCE];
+    uint32_t* vtx_tri_start;    // start of each vertex's triangle list in tri_list
+    uint32_t* vtx_tri_count;    // number of not yet emitted triangles per vertex
+    int32_t* vtx_cache_pos;     // position in simulated cache, or -1
+    float* vtx_score;
+    uint32_t* tri_list;         // per-vertex lists of adjacent triangles
+    float* tri_score;
+    bool* tri_emitted;
+} _sshape_vcache_t;
+
+static float _sshape_vcache_vertex_score(const _sshape_vcache_t* vc, uint32_t vtx) {
+    const uint32_t tri_count = vc->vtx_tri_count[vtx];
+    if (0 == tri_count) {
+        // no triangles left, the vertex doesn't matter anymore
+        return -1.0f;
+    }
+    float score = 0.0f;
+    const int32_t cache_pos = vc->vtx_cache_pos[vtx];
+    if (cache_pos >= 0) {
+        score = vc->cache_score[cache_pos];
+    }
+    score += vc->valence_score[(tri_count < _SSHAPE_VCACHE_MAX_VALENCE) ? tri_count : (_SSHAPE_VCACHE_MAX_VALENCE - 1)];
+    return score;
+}
+
+/* reorder num_indices local (zero-based) indices in place, returns false if out of memory */
+static bool _sshape_vcache_optimize(uint32_t* indices, uint32_t num_indices, uint32_t num_vertices) {
+    const uint32_t num_tris = num_indices / 3;
+    _sshape_vcache_t vc;
+    memset(&vc, 0, sizeof(vc));
+
+    // score tables: the last triangle's vertices get a fixed score to
+    // avoid favouring the vertices of the most recent triangle too much
+    const float cache_decay_power = 1.5f;
+    const float last_tri_score = 0.75f;
+    const float valence_boost_scale = 2.0f;
+    const float valence_boost_power = 0.5f;
+    for (int i = 0; i < _SSHAPE_VCACHE_SIZE; i++) {
+        if (i < 3) {
+            vc.cache_score[i] = last_tri_score;
+        }
+        else {
+            const float scaler = 1.0f / (_SSHAPE_VCACHE_SIZE - 3);
+            vc.cache_score[i] = powf(1.0f - (float)(i - 3) * scaler, cache_decay_power);
+        }
+    }
+    vc.valence_score[0] = 0.0f;
+    for (int i = 1; i < _SSHAPE_VCACHE_MAX_VALENCE; i++) {
+        vc.valence_score[i] = valence_boost_scale * powf((float)i, -valence_boost_power);
+    }
+
+    vc.vtx_tri_start = (uint32_t*) SOKOL_MALLOC(num_vertices * sizeof(uint32_t));
+    vc.vtx_tri_count = (uint32_t*) SOKOL_MALLOC(num_vertices * sizeof(uint32_t));
+    vc.vtx_cache_pos = (int32_t*) SOKOL_MALLOC(num_vertices * sizeof(int32_t));
+    vc.vtx_score = (float*) SOKOL_MALLOC(num_vertices * sizeof(float));
+    vc.tri_list = (uint32_t*) SOKOL_MALLOC(num_indices * sizeof(uint32_t));
+    vc.tri_score = (float*) SOKOL_MALLOC(num_tris * sizeof(float));
+    vc.tri_emitted = (bool*) SOKOL_MALLOC(num_tris * sizeof(bool));
+    uint32_t* out_indices = (uint32_t*) SOKOL_MALLOC(num_indices * sizeof(uint32_t));
+    const bool ok = vc.vtx_tri_start && vc.vtx_tri_count && vc.vtx_cache_pos && vc.vtx_score &&
+                    vc.tri_list && vc.tri_score && vc.tri_emitted && out_indices;
+    if (ok) {
+        // build vertex => triangle adjacency
+        memset(vc.vtx_tri_count, 0, num_vertices * sizeof(uint32_t));
+        for (uint32_t i = 0; i < num_indices; i++) {
+            vc.vtx_tri_count[indices[i]]++;
+        }
+        uint32_t start = 0;
+        for (uint32_t v = 0; v < num_vertices; v++) {
+            vc.vtx_tri_start[v] = start;
+            start += vc.vtx_tri_count[v];
+            vc.vtx_tri_count[v] = 0;
+            vc.vtx_cache_pos[v] = -1;
+        }
+        for (uint32_t t = 0; t < num_tris; t++) {
+            for (uint32_t k = 0; k < 3; k++) {
+                const uint32_t v = indices[t * 3 + k];
+                vc.tri_list[vc.vtx_tri_start[v] + vc.vtx_tri_count[v]++] = t;
+            }
+        }
+        // initial scores
+        for (uint32_t v = 0; v < num_vertices; v++) {
+            vc.vtx_score[v] = _sshape_vcache_vertex_score(&vc, v);
+        }
+        for (uint32_t t = 0; t < num_tris; t++) {
+            vc.tri_emitted[t] = false;
+            vc.tri_score[t] = vc.vtx_score[indices[t*3+0]] + vc.vtx_score[indices[t*3+1]] + vc.vtx_score[indices[t*3+2]];
+        }
+
+        // the simulated cache has room for the 3 vertices of the new triangle
+        uint32_t cache[_SSHAPE_VCACHE_SIZE + 3];
+        uint32_t cache_size = 0;
+        int64_t best_tri = -1;
+        uint32_t scan_pos = 0;
+        for (uint32_t out_tri = 0; out_tri < num_tris; out_tri++) {
+            if (best_tri < 0) {
+                // no candidate in cache, find the best remaining triangle
+                float best_score = -1.0f;
+                for (uint32_t t = scan_pos; t < num_tris; t++) {
+                    if (!vc.tri_emitted[t] && (vc.tri_score[t] > best_score)) {
+                        best_score = vc.tri_score[t];
+                        best_tri = t;
+                    }
+                }
+                SOKOL_ASSERT(best_tri >= 0);
+            }
+            const uint32_t tri = (uint32_t) best_tri;
+            vc.tri_emitted[tri] = true;
+            while ((scan_pos < num_tris) && vc.tri_emitted[scan_pos]) {
+                scan_pos++;
+            }
+
+            // emit the triangle, and remove it from its vertices' triangle lists
+            uint32_t new_cache[_SSHAPE_VCACHE_SIZE + 3];
+            uint32_t new_cache_size = 0;
+            for (uint32_t k = 0; k < 3; k++) {
+                const uint32_t v = indices[tri * 3 + k];
+                out_indices[out_tri * 3 + k] = v;
+                uint32_t* tris = &vc.tri_list[vc.vtx_tri_start[v]];
+                const uint32_t count = vc.vtx_tri_count[v];
+                for (uint32_t j = 0; j < count; j++) {
+                    if (tris[j] == tri) {
+                        tris[j] = tris[count - 1];
+                        break;
+                    }
+                }
+                vc.vtx_tri_count[v]--;
+                new_cache[new_cache_size++] = v;
+            }
+
+            // update the simulated LRU cache, the new vertices move to the front
+            for (uint32_t i = 0; i < cache_size; i++) {
+                const uint32_t v = cache[i];
+                if ((v != new_cache[0]) && (v != new_cache[1]) && (v != new_cache[2])) {
+                    new_cache[new_cache_size++] = v;
+                }
+            }
+            for (uint32_t i = 0; i < new_cache_size; i++) {
+                const uint32_t v = new_cache[i];
+                vc.vtx_cache_pos[v] = (i < _SSHAPE_VCACHE_SIZE) ? (int32_t)i : -1;
+            }
+            cache_size = (new_cache_size < _SSHAPE_VCACHE_SIZE) ? new_cache_size : _SSHAPE_VCACHE_SIZE;
+            memcpy(cache, new_cache, cache_size * sizeof(uint32_t));
+
+            // update the scores of all vertices that were in the cache, and of their triangles
+            for (uint32_t i = 0; i < new_cache_size; i++) {
+                const uint32_t v = new_cache[i];
+                const float new_score = _sshape_vcache_vertex_score(&vc, v);
+                const float delta = new_score - vc.vtx_score[v];
+                vc.vtx_score[v] = new_score;
+                const uint32_t* tris = &vc.tri_list[vc.vtx_tri_start[v]];
+                for (uint32_t j = 0; j < vc.vtx_tri_count[v]; j++) {
+                    vc.tri_score[tris[j]] += delta;
+                }
+            }
+
+            // next candidate is the best triangle which uses a cached vertex
+            best_tri = -1;
+            float best_score = -1.0f;
+            for (uint32_t i = 0; i < cache_size; i++) {
+                const uint32_t v = cache[i];
+                const uint32_t* tris = &vc.tri_list[vc.vtx_tri_start[v]];
+                for (uint32_t j = 0; j < vc.vtx_tri_count[v]; j++) {
+                    if (vc.tri_score[tris[j]] > best_score) {
+                        best_score = vc.tri_score[tris[j]];
+                        best_tri = tris[j];
+                    }
+                }
+            }
+        }
+        memcpy(indices, out_indices, num_indices * sizeof(uint32_t));
+    }
+    SOKOL_FREE(out_indices);
+    SOKOL_FREE(vc.tri_emitted);
+    SOKOL_FREE(vc.tri_score);
+    SOKOL_FREE(vc.tri_list);
+    SOKOL_FREE(vc.vtx_score);
+    SOKOL_FREE(vc.vtx_cache_pos);
+    SOKOL_FREE(vc.vtx_tri_count);
+    SOKOL_FREE(vc.vtx_tri_start);
+    return ok;
+}
+
 /*=== PUBLIC API FUNCTIONS ===================================================*/
 SOKOL_API_IMPL uint32_t sshape_color_4f(float r, float g, float b, float a) {
     return _sshape_pack_f4_ubyte4n(_sshape_clamp(r), _sshape_clamp(g), _sshape_clamp(b), _sshape_clamp(a));
@@ -932,7 +1262,7 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_plane(const sshape_buffer_t* in_buf,
         return buf;
     }
     buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
+    const uint32_t start_index = _sshape_base_index(&buf);
     if (!params.merge) {
         _sshape_advance_offset(&buf.vertices);
         _sshape_advance_offset(&buf.indices);
@@ -959,10 +1289,10 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_plane(const sshape_buffer_t* in_buf,
     // write indices
     for (uint16_t j = 0; j < params.tiles; j++) {
         for (uint16_t i = 0; i < params.tiles; i++) {
-            const uint16_t i0 = start_index + (j * (params.tiles + 1)) + i;
-            const uint16_t i1 = i0 + 1;
-            const uint16_t i2 = i0 + params.tiles + 1;
-            const uint16_t i3 = i2 + 1;
+            const uint32_t i0 = start_index + (j * (params.tiles + 1)) + i;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + params.tiles + 1;
+            const uint32_t i3 = i2 + 1;
             _sshape_add_triangle(&buf, i0, i1, i3);
             _sshape_add_triangle(&buf, i0, i3, i2);
         }
@@ -981,7 +1311,7 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_box(const sshape_buffer_t* in_buf, c
         return buf;
     }
     buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
+    const uint32_t start_index = _sshape_base_index(&buf);
     if (!params.merge) {
         _sshape_advance_offset(&buf.vertices);
         _sshape_advance_offset(&buf.indices);
@@ -1052,15 +1382,15 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_box(const sshape_buffer_t* in_buf, c
     }
 
     // build indices
-    const uint16_t verts_per_face = (params.tiles + 1) * (params.tiles + 1);
+    const uint32_t verts_per_face = (params.tiles + 1) * (params.tiles + 1);
     for (uint16_t face = 0; face < 6; face++) {
-        uint16_t face_start_index = start_index + face * verts_per_face;
+        uint32_t face_start_index = start_index + face * verts_per_face;
         for (uint16_t j = 0; j < params.tiles; j++) {
             for (uint16_t i = 0; i < params.tiles; i++) {
-                const uint16_t i0 = face_start_index + (j * (params.tiles + 1)) + i;
-                const uint16_t i1 = i0 + 1;
-                const uint16_t i2 = i0 + params.tiles + 1;
-                const uint16_t i3 = i2 + 1;
+                const uint32_t i0 = face_start_index + (j * (params.tiles + 1)) + i;
+                const uint32_t i1 = i0 + 1;
+                const uint32_t i2 = i0 + params.tiles + 1;
+                const uint32_t i3 = i2 + 1;
                 _sshape_add_triangle(&buf, i0, i1, i3);
                 _sshape_add_triangle(&buf, i0, i3, i2);
             }
@@ -1097,15 +1427,16 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf
         return buf;
     }
     buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
+    const uint32_t start_index = _sshape_base_index(&buf);
     if (!params.merge) {
         _sshape_advance_offset(&buf.vertices);
         _sshape_advance_offset(&buf.indices);
     }
 
     uint32_t rand_seed = 0x12345678;
+    _sshape_sincos_table_t slice_table;
+    _sshape_sincos_init(&slice_table, params.slices);
     const float pi = 3.14159265358979323846f;
-    const float two_pi = 2.0f * pi;
     const float du = 1.0f / params.slices;
     const float dv = 1.0f / params.stacks;
 
@@ -1115,9 +1446,9 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf
         const float sin_stack = sinf(stack_angle);
         const float cos_stack = cosf(stack_angle);
         for (uint32_t slice = 0; slice <= params.slices; slice++) {
-            const float slice_angle = (two_pi * slice) / params.slices;
-            const float sin_slice = sinf(slice_angle);
-            const float cos_slice = cosf(slice_angle);
+            const _sshape_sincos_t sc = _sshape_sincos(&slice_table, slice);
+            const float sin_slice = sc.s;
+            const float cos_slice = sc.c;
             const _sshape_vec4_t norm = _sshape_vec4(-sin_slice * sin_stack, cos_stack, cos_slice * sin_stack, 0.0f);
             const _sshape_vec4_t pos = _sshape_vec4(norm.x * params.radius, norm.y * params.radius, norm.z * params.radius, 1.0f);
             const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
@@ -1131,16 +1462,16 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf
     // generate indices
     {
         // north-pole triangles
-        const uint16_t row_a = start_index;
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index;
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice, row_b + slice + 1);
         }
     }
     // stack triangles
     for (uint16_t stack = 1; stack < params.stacks - 1; stack++) {
-        const uint16_t row_a = start_index + stack * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index + stack * (params.slices + 1);
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_a + slice + 1);
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice, row_b + slice + 1);
@@ -1148,8 +1479,8 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf
     }
     {
         // south-pole triangles
-        const uint16_t row_a = start_index + (params.stacks - 1) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index + (params.stacks - 1) * (params.slices + 1);
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_a + slice + 1);
         }
@@ -1186,13 +1517,12 @@ static void _sshape_build_cylinder_cap_pole(sshape_buffer_t* buf, const sshape_c
     }
 }
 
-static void _sshape_build_cylinder_cap_ring(sshape_buffer_t* buf, const sshape_cylinder_t* params, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
-    const float two_pi = 2.0f * 3.14159265358979323846f;
+static void _sshape_build_cylinder_cap_ring(sshape_buffer_t* buf, const sshape_cylinder_t* params, _sshape_sincos_table_t* slice_table, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
     const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, _sshape_vec4(0.0f, norm_y, 0.0f, 0.0f)));
     for (uint32_t slice = 0; slice <= params->slices; slice++) {
-        const float slice_angle = (two_pi * slice) / params->slices;
-        const float sin_slice = sinf(slice_angle);
-        const float cos_slice = cosf(slice_angle);
+        const _sshape_sincos_t sc = _sshape_sincos(slice_table, slice);
+        const float sin_slice = sc.s;
+        const float cos_slice = sc.c;
         const _sshape_vec4_t pos = _sshape_vec4(sin_slice * params->radius, pos_y, cos_slice * params->radius, 1.0f);
         const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
         const _sshape_vec2_t uv = _sshape_vec2(slice * du, 1.0f - v);
@@ -1212,14 +1542,15 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t
         return buf;
     }
     buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
+    const uint32_t start_index = _sshape_base_index(&buf);
     if (!params.merge) {
         _sshape_advance_offset(&buf.vertices);
         _sshape_advance_offset(&buf.indices);
     }
 
     uint32_t rand_seed = 0x12345678;
-    const float two_pi = 2.0f * 3.14159265358979323846f;
+    _sshape_sincos_table_t slice_table;
+    _sshape_sincos_init(&slice_table, params.slices);
     const float du = 1.0f / params.slices;
     const float dv = 1.0f / (params.stacks + 2);
     const float y0 = params.height * 0.5f;
@@ -1228,14 +1559,14 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t
 
     // generate vertices
     _sshape_build_cylinder_cap_pole(&buf, &params, y0, 1.0f, du, 0.0f, &rand_seed);
-    _sshape_build_cylinder_cap_ring(&buf, &params, y0, 1.0f, du, dv, &rand_seed);
+    _sshape_build_cylinder_cap_ring(&buf, &params, &slice_table, y0, 1.0f, du, dv, &rand_seed);
     for (uint32_t stack = 0; stack <= params.stacks; stack++) {
         const float y = y0 - dy * stack;
         const float v = dv * stack + dv;
         for (uint32_t slice = 0; slice <= params.slices; slice++) {
-            const float slice_angle = (two_pi * slice) / params.slices;
-            const float sin_slice = sinf(slice_angle);
-            const float cos_slice = cosf(slice_angle);
+            const _sshape_sincos_t sc = _sshape_sincos(&slice_table, slice);
+            const float sin_slice = sc.s;
+            const float cos_slice = sc.c;
             const _sshape_vec4_t pos = _sshape_vec4(sin_slice * params.radius, y, cos_slice * params.radius, 1.0f);
             const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
             const _sshape_vec4_t norm = _sshape_vec4(sin_slice, 0.0f, cos_slice, 0.0f);
@@ -1245,22 +1576,22 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t
             _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
         }
     }
-    _sshape_build_cylinder_cap_ring(&buf, &params, y1, -1.0f, du, 1.0f - dv, &rand_seed);
+    _sshape_build_cylinder_cap_ring(&buf, &params, &slice_table, y1, -1.0f, du, 1.0f - dv, &rand_seed);
     _sshape_build_cylinder_cap_pole(&buf, &params, y1, -1.0f, du, 1.0f, &rand_seed);
 
     // generate indices
     {
         // top-cap indices
-        const uint16_t row_a = start_index;
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index;
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_b + slice);
         }
     }
     // shaft triangles
     for (uint16_t stack = 0; stack < params.stacks; stack++) {
-        const uint16_t row_a = start_index + (stack + 2) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index + (stack + 2) * (params.slices + 1);
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_a + slice + 1, row_b + slice + 1);
             _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_b + slice);
@@ -1268,8 +1599,8 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t
     }
     {
         // bottom-cap indices
-        const uint16_t row_a = start_index + (params.stacks + 3) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
+        const uint32_t row_a = start_index + (params.stacks + 3) * (params.slices + 1);
+        const uint32_t row_b = row_a + params.slices + 1;
         for (uint16_t slice = 0; slice < params.slices; slice++) {
             _sshape_add_triangle(&buf, row_a + slice, row_a + slice + 1, row_b + slice + 1);
         }
@@ -1305,13 +1636,15 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf,
         return buf;
     }
     buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
+    const uint32_t start_index = _sshape_base_index(&buf);
     if (!params.merge) {
         _sshape_advance_offset(&buf.vertices);
         _sshape_advance_offset(&buf.indices);
     }
 
     uint32_t rand_seed = 0x12345678;
+    _sshape_sincos_table_t ring_table;
+    _sshape_sincos_init(&ring_table, params.rings);
     const float two_pi = 2.0f * 3.14159265358979323846f;
     const float dv = 1.0f / params.sides;
     const float du = 1.0f / params.rings;
@@ -1322,9 +1655,9 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf,
         const float sin_phi = sinf(phi);
         const float cos_phi = cosf(phi);
         for (uint32_t ring = 0; ring <= params.rings; ring++) {
-            const float theta = (ring * two_pi) / params.rings;
-            const float sin_theta = sinf(theta);
-            const float cos_theta = cosf(theta);
+            const _sshape_sincos_t sc = _sshape_sincos(&ring_table, ring);
+            const float sin_theta = sc.s;
+            const float cos_theta = sc.c;
 
             // torus surface position
             const float spx = sin_theta * (params.radius - (params.ring_radius * cos_phi));
@@ -1348,8 +1681,8 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf,
 
     // generate indices
     for (uint16_t side = 0; side < params.sides; side++) {
-        const uint16_t row_a = start_index + side * (params.rings + 1);
-        const uint16_t row_b = row_a + params.rings + 1;
+        const uint32_t row_a = start_index + side * (params.rings + 1);
+        const uint32_t row_b = row_a + params.rings + 1;
         for (uint16_t ring = 0; ring < params.rings; ring++) {
             _sshape_add_triangle(&buf, row_a + ring, row_a + ring + 1, row_b + ring + 1);
             _sshape_add_triangle(&buf, row_a + ring, row_b + ring + 1, row_b + ring);
@@ -1358,6 +1691,74 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf,
     return buf;
 }
 
+SOKOL_API_IMPL sshape_buffer_t sshape_optimize(const sshape_buffer_t* in_buf) {
+    SOKOL_ASSERT(in_buf && in_buf->valid);
+    sshape_buffer_t buf = *in_buf;
+    if (!buf.valid) {
+        return buf;
+    }
+    // the current shape's vertex- and index-range
+    const uint32_t base_vertex = (uint32_t) (buf.vertices.shape_offset / sizeof(sshape_vertex_t));
+    const uint32_t num_vertices = (uint32_t) ((buf.vertices.data_size - buf.vertices.shape_offset) / sizeof(sshape_vertex_t));
+    const uint32_t num_indices = (uint32_t) ((buf.indices.data_size - buf.indices.shape_offset) / _sshape_index_size(&buf));
+    if ((0 == num_vertices) || (num_indices < 6)) {
+        return buf;
+    }
+    sshape_vertex_t* vertices = (sshape_vertex_t*) ((uint8_t*)buf.vertices.buffer.ptr + buf.vertices.shape_offset);
+    uint16_t* indices16 = (uint16_t*) ((uint8_t*)buf.indices.buffer.ptr + buf.indices.shape_offset);
+    uint32_t* indices32 = (uint32_t*) indices16;
+
+    uint32_t* local_indices = (uint32_t*) SOKOL_MALLOC(num_indices * sizeof(uint32_t));
+    uint32_t* remap = (uint32_t*) SOKOL_MALLOC(num_vertices * sizeof(uint32_t));
+    sshape_vertex_t* tmp_vertices = (sshape_vertex_t*) SOKOL_MALLOC(num_vertices * sizeof(sshape_vertex_t));
+    if (local_indices && remap && tmp_vertices) {
+        for (uint32_t i = 0; i < num_indices; i++) {
+            const uint32_t index = buf.index32 ? indices32[i] : indices16[i];
+            SOKOL_ASSERT((index >= base_vertex) && (index < (base_vertex + num_vertices)));
+            local_indices[i] = index - base_vertex;
+        }
+        // reorder triangles for vertex cache locality
+        if (_sshape_vcache_optimize(local_indices, num_indices, num_vertices)) {
+            // reorder vertices by first use for vertex fetch locality,
+            // unreferenced vertices are moved to the end
+            const uint32_t unused = 0xFFFFFFFF;
+            for (uint32_t v = 0; v < num_vertices; v++) {
+                remap[v] = unused;
+            }
+            uint32_t next_vertex = 0;
+            for (uint32_t i = 0; i < num_indices; i++) {
+                const uint32_t v = local_indices[i];
+                if (remap[v] == unused) {
+                    remap[v] = next_vertex++;
+                }
+            }
+            for (uint32_t v = 0; v < num_vertices; v++) {
+                if (remap[v] == unused) {
+                    remap[v] = next_vertex++;
+                }
+            }
+            SOKOL_ASSERT(next_vertex == num_vertices);
+            memcpy(tmp_vertices, vertices, num_vertices * sizeof(sshape_vertex_t));
+            for (uint32_t v = 0; v < num_vertices; v++) {
+                vertices[remap[v]] = tmp_vertices[v];
+            }
+            for (uint32_t i = 0; i < num_indices; i++) {
+                const uint32_t index = base_vertex + remap[local_indices[i]];
+                if (buf.index32) {
+                    indices32[i] = index;
+                }
+                else {
+                    indices16[i] = (uint16_t) index;
+                }
+            }
+        }
+    }
+    SOKOL_FREE(tmp_vertices);
+    SOKOL_FREE(remap);
+    SOKOL_FREE(local_indices);
+    return buf;
+}
+
 SOKOL_API_IMPL sg_buffer_desc sshape_vertex_buffer_desc(const sshape_buffer_t* buf) {
     SOKOL_ASSERT(buf && buf->valid);
     sg_buffer_desc desc = { 0 };
@@ -1382,15 +1783,21 @@ SOKOL_API_IMPL sg_buffer_desc sshape_index_buffer_desc(const sshape_buffer_t* bu
     return desc;
 }
 
+SOKOL_API_IMPL sg_index_type sshape_index_type(const sshape_buffer_t* buf) {
+    SOKOL_ASSERT(buf);
+    return buf->index32 ? SG_INDEXTYPE_UINT32 : SG_INDEXTYPE_UINT16;
+}
+
 SOKOL_SHAPE_API_DECL sshape_element_range_t sshape_element_range(const sshape_buffer_t* buf) {
     SOKOL_ASSERT(buf && buf->valid);
     SOKOL_ASSERT(buf->indices.shape_offset < buf->indices.data_size);
-    SOKOL_ASSERT(0 == (buf->indices.shape_offset & (sizeof(uint16_t) - 1)));
-    SOKOL_ASSERT(0 == (buf->indices.data_size & (sizeof(uint16_t) - 1)));
+    const uint32_t index_size = _sshape_index_size(buf);
+    SOKOL_ASSERT(0 == (buf->indices.shape_offset & (index_size - 1)));
+    SOKOL_ASSERT(0 == (buf->indices.data_size & (index_size - 1)));
     sshape_element_range_t range = { 0 };
-    range.base_element = (int) (buf->indices.shape_offset / sizeof(uint16_t));
+    range.base_element = (int) (buf->indices.shape_offset / index_size);
     if (buf->valid) {
-        range.num_elements = (int) ((buf->indices.data_size - buf->indices.shape_offset) / sizeof(uint16_t));
+        range.num_elements = (int) ((buf->indices.data_size - buf->indices.shape_offset) / index_size);
     }
     else {
         range.num_elements = 0;